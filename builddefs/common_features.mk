@@ -133,6 +133,8 @@ ifeq ($(strip $(POINTING_DEVICE_ENABLE)), yes)
         VPATH += $(QUANTUM_DIR)/pointing_device
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device.c
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_auto_mouse.c
+        SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_sampling.c
+        SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_acceleration.c
         ifneq ($(strip $(POINTING_DEVICE_DRIVER)), custom)
             SRC += drivers/sensors/$(strip $(POINTING_DEVICE_DRIVER)).c
             OPT_DEFS += -DPOINTING_DEVICE_DRIVER_$(strip $(shell echo $(POINTING_DEVICE_DRIVER) | tr '[:lower:]' '[:upper:]'))
@@ -659,6 +661,7 @@ ifneq ($(strip $(CUSTOM_MATRIX)), yes)
     ifneq ($(strip $(CUSTOM_MATRIX)), lite)
         # Include the standard or split matrix code if needed
         QUANTUM_SRC += $(QUANTUM_DIR)/matrix.c
+        QUANTUM_SRC += $(QUANTUM_DIR)/matrix_port.c
     endif
 endif
 
@@ -690,6 +693,8 @@ ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
                        $(QUANTUM_DIR)/split_common/transactions.c
 
         OPT_DEFS += -DSPLIT_COMMON_TRANSACTIONS
+        QUANTUM_LIB_SRC += split_oled_rle.c \
+                           split_adaptive_sync.c
 
         # Functions added via QUANTUM_LIB_SRC are only included in the final binary if they're called.
         # Unused functions are pruned away, which is why we can add multiple drivers here without bloat.
@@ -1001,6 +1006,12 @@ endif
 ifeq ($(strip $(I2C_DRIVER_REQUIRED)), yes)
     OPT_DEFS += -DHAL_USE_I2C=TRUE
     QUANTUM_LIB_SRC += i2c_master.c
+    ifeq ($(strip $(I2C_ASYNC_ENABLE)), yes)
+        ifeq ($(filter $(PLATFORM_KEY),chibios test),)
+            $(call CATASTROPHIC_ERROR,Invalid I2C_ASYNC_ENABLE,I2C_ASYNC_ENABLE is not supported on the "$(PLATFORM_KEY)" platform)
+        endif
+        OPT_DEFS += -DI2C_ASYNC_ENABLE
+    endif
 endif
 
 ifeq ($(strip $(SPI_DRIVER_REQUIRED)), yes)
@@ -38,9 +38,11 @@ GENERIC_FEATURES = \
     KEYCODE_STRING \
     KEY_LOCK \
     KEY_OVERRIDE \
+    LATENCY_TRACE \
     LAYER_LOCK \
     LEADER \
     MAGIC \
+    MATRIX_EVENT_QUEUE \
     MOUSEKEY \
     MUSIC \
     OS_DETECTION \
@@ -74,6 +74,20 @@ static int8_t encoder_LUT[] = {0, -1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1,
 static uint8_t encoder_state[NUM_ENCODERS]  = {0};
 static int8_t  encoder_pulses[NUM_ENCODERS] = {0};
 
+#ifdef ENCODER_QUADRATURE_INTERRUPT
+#    ifndef ENCODER_QUADRATURE_STEP_QUEUE_SIZE
+#        define ENCODER_QUADRATURE_STEP_QUEUE_SIZE 64
+#    endif
+_Static_assert(ENCODER_QUADRATURE_STEP_QUEUE_SIZE >= 8 && ENCODER_QUADRATURE_STEP_QUEUE_SIZE <= 128 && (ENCODER_QUADRATURE_STEP_QUEUE_SIZE & (ENCODER_QUADRATURE_STEP_QUEUE_SIZE - 1)) == 0, "ENCODER_QUADRATURE_STEP_QUEUE_SIZE must be a power of two between 8 and 128");
+
+// Steps decoded by the pin change interrupt, in order, as one direction bit per step. The
+// interrupt is the only writer of the bits and the head, encoder_driver_task() the only
+// writer of the tail, so the two never write the same variable.
+static volatile uint8_t encoder_step_bits[NUM_ENCODERS_MAX_PER_SIDE][ENCODER_QUADRATURE_STEP_QUEUE_SIZE / 8] = {0};
+static volatile uint8_t encoder_step_head[NUM_ENCODERS_MAX_PER_SIDE]                                        = {0};
+static volatile uint8_t encoder_step_tail[NUM_ENCODERS_MAX_PER_SIDE]                                        = {0};
+#endif
+
 // encoder counts
 static uint8_t thisCount;
 #ifdef SPLIT_KEYBOARD
@@ -89,6 +103,23 @@ __attribute__((weak)) void encoder_quadrature_post_init_kb(void) {
     // During the interrupt, read the pins then call `encoder_handle_read()` with the pin states and it'll queue up an encoder event if needed.
 }
 
+#if defined(ENCODER_QUADRATURE_INTERRUPT) && defined(ENCODER_DEFAULT_PIN_API_IMPL) && defined(PROTOCOL_CHIBIOS)
+void encoder_quadrature_handle_read(uint8_t index, uint8_t pin_a_state, uint8_t pin_b_state);
+
+static void encoder_quadrature_pin_changed(void *arg) {
+    uint8_t index = (uint8_t)(uintptr_t)arg;
+    encoder_quadrature_handle_read(index, encoder_quadrature_read_pin(index, false), encoder_quadrature_read_pin(index, true));
+}
+
+static void encoder_quadrature_enable_interrupt(uint8_t index, bool pad_b) {
+    pin_t pin = pad_b ? encoders_pad_b[index] : encoders_pad_a[index];
+    if (pin != NO_PIN) {
+        palSetLineCallback(pin, encoder_quadrature_pin_changed, (void *)(uintptr_t)index);
+        palEnableLineEvent(pin, PAL_EVENT_MODE_BOTH_EDGES);
+    }
+}
+#endif
+
 void encoder_quadrature_post_init(void) {
 #ifdef ENCODER_DEFAULT_PIN_API_IMPL
     for (uint8_t i = 0; i < thisCount; i++) {
@@ -99,6 +130,12 @@ void encoder_quadrature_post_init(void) {
     for (uint8_t i = 0; i < thisCount; i++) {
         encoder_state[i] = (encoder_quadrature_read_pin(i, false) << 0) | (encoder_quadrature_read_pin(i, true) << 1);
     }
+#    if defined(ENCODER_QUADRATURE_INTERRUPT) && defined(PROTOCOL_CHIBIOS)
+    for (uint8_t i = 0; i < thisCount; i++) {
+        encoder_quadrature_enable_interrupt(i, false);
+        encoder_quadrature_enable_interrupt(i, true);
+    }
+#    endif
 #else
     memset(encoder_state, 0, sizeof(encoder_state));
 #endif
@@ -123,6 +160,11 @@ void encoder_driver_init(void) {
     // here, but it's the simplest solution.
     memset(encoder_state, 0, sizeof(encoder_state));
     memset(encoder_pulses, 0, sizeof(encoder_pulses));
+#    ifdef ENCODER_QUADRATURE_INTERRUPT
+    memset((void *)encoder_step_bits, 0, sizeof(encoder_step_bits));
+    memset((void *)encoder_step_head, 0, sizeof(encoder_step_head));
+    memset((void *)encoder_step_tail, 0, sizeof(encoder_step_tail));
+#    endif
     const pin_t encoders_pad_a_left[] = ENCODER_A_PINS;
     const pin_t encoders_pad_b_left[] = ENCODER_B_PINS;
     for (uint8_t i = 0; i < thisCount; i++) {
@@ -158,6 +200,25 @@ void encoder_driver_init(void) {
     encoder_quadrature_post_init();
 }
 
+static inline void encoder_step(uint8_t index, uint8_t i, bool clockwise) {
+#ifdef ENCODER_QUADRATURE_INTERRUPT
+    uint8_t head = encoder_step_head[i];
+    if ((uint8_t)(head - encoder_step_tail[i]) >= ENCODER_QUADRATURE_STEP_QUEUE_SIZE) {
+        // The main loop has fallen too far behind, drop the step.
+        return;
+    }
+    uint8_t bit = head % ENCODER_QUADRATURE_STEP_QUEUE_SIZE;
+    if (clockwise) {
+        encoder_step_bits[i][bit / 8] |= (1 << (bit % 8));
+    } else {
+        encoder_step_bits[i][bit / 8] &= ~(1 << (bit % 8));
+    }
+    encoder_step_head[i] = head + 1;
+#else
+    encoder_queue_event(index, clockwise);
+#endif
+}
+
 static void encoder_handle_state_change(uint8_t index, uint8_t state) {
     uint8_t i = index;
 
@@ -180,7 +241,7 @@ static void encoder_handle_state_change(uint8_t index, uint8_t state) {
     if (encoder_pulses[i] >= resolution) {
 #endif
 
-            encoder_queue_event(index, ENCODER_COUNTER_CLOCKWISE);
+            encoder_step(index, i, ENCODER_COUNTER_CLOCKWISE);
         }
 
 #ifdef ENCODER_DEFAULT_POS
@@ -188,7 +249,7 @@ static void encoder_handle_state_change(uint8_t index, uint8_t state) {
 #else
     if (encoder_pulses[i] <= -resolution) { // direction is arbitrary here, but this clockwise
 #endif
-            encoder_queue_event(index, ENCODER_CLOCKWISE);
+            encoder_step(index, i, ENCODER_CLOCKWISE);
         }
         encoder_pulses[i] %= resolution;
 #ifdef ENCODER_DEFAULT_POS
@@ -206,8 +267,29 @@ void encoder_quadrature_handle_read(uint8_t index, uint8_t pin_a_state, uint8_t
     }
 }
 
+#ifdef ENCODER_QUADRATURE_INTERRUPT
+__attribute__((weak)) void encoder_driver_task(void) {
+    for (uint8_t i = 0; i < thisCount; i++) {
+        uint8_t index = i;
+#    ifdef SPLIT_KEYBOARD
+        index += thisHand;
+#    endif
+        // Steps that do not fit in the event queue stay pending for the next task run.
+        uint8_t tail = encoder_step_tail[i];
+        while (tail != encoder_step_head[i]) {
+            uint8_t bit       = tail % ENCODER_QUADRATURE_STEP_QUEUE_SIZE;
+            bool    clockwise = encoder_step_bits[i][bit / 8] & (1 << (bit % 8));
+            if (!encoder_queue_event(index, clockwise)) {
+                break;
+            }
+            encoder_step_tail[i] = ++tail;
+        }
+    }
+}
+#else
 __attribute__((weak)) void encoder_driver_task(void) {
     for (uint8_t i = 0; i < thisCount; i++) {
         encoder_quadrature_handle_read(i, encoder_quadrature_read_pin(i, false), encoder_quadrature_read_pin(i, true));
     }
 }
+#endif
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 
 /**
  * \file
@@ -138,4 +139,69 @@ i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* dat
  */
 i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout);
 
+#if defined(I2C_ASYNC_ENABLE) || defined(__DOXYGEN__)
+#    ifndef I2C_ASYNC_QUEUE_SIZE
+#        define I2C_ASYNC_QUEUE_SIZE 32
+#    endif
+#    ifndef I2C_ASYNC_MAX_LENGTH
+#        define I2C_ASYNC_MAX_LENGTH 32
+#    endif
+
+/**
+ * \brief Callback invoked from `i2c_async_task()` once a queued transaction has completed.
+ *
+ * \param status The result of the transaction, as per the synchronous API.
+ * \param arg The user pointer given when the transaction was queued.
+ */
+typedef void (*i2c_async_callback_t)(i2c_status_t status, void* arg);
+
+/**
+ * \brief Queue a transmission of multiple bytes to the selected I2C device, returning immediately.
+ *
+ * The data is copied into the queue, so the caller's buffer may be reused as soon as this function returns. If the queue is full, this function blocks until a slot has been freed.
+ *
+ * \param address The 7-bit I2C address of the device.
+ * \param data A pointer to the data to transmit.
+ * \param length The number of bytes to write. Must not exceed `I2C_ASYNC_MAX_LENGTH`.
+ * \param callback The function to call once the transaction has completed, or `NULL`.
+ * \param arg A user pointer passed through to `callback`.
+ *
+ * \return `I2C_STATUS_ERROR` if the transaction could not be queued, otherwise `I2C_STATUS_SUCCESS`.
+ */
+i2c_status_t i2c_transmit_async(uint8_t address, const uint8_t* data, uint16_t length, i2c_async_callback_t callback, void* arg);
+
+/**
+ * \brief Queue a write to a register with an 8-bit address on the I2C device, returning immediately.
+ *
+ * The data is copied into the queue, so the caller's buffer may be reused as soon as this function returns. If the queue is full, this function blocks until a slot has been freed.
+ *
+ * \param devaddr The 7-bit I2C address of the device.
+ * \param regaddr The register address to write to.
+ * \param data A pointer to the data to transmit.
+ * \param length The number of bytes to write. Must not exceed `I2C_ASYNC_MAX_LENGTH - 1`.
+ * \param callback The function to call once the transaction has completed, or `NULL`.
+ * \param arg A user pointer passed through to `callback`.
+ *
+ * \return `I2C_STATUS_ERROR` if the transaction could not be queued, otherwise `I2C_STATUS_SUCCESS`.
+ */
+i2c_status_t i2c_write_register_async(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, i2c_async_callback_t callback, void* arg);
+
+/**
+ * \brief Check whether any queued transaction has not yet been completed and reported.
+ */
+bool i2c_async_busy(void);
+
+/**
+ * \brief Block until every queued transaction has completed, dispatching their callbacks.
+ *
+ * The synchronous API calls this implicitly, so that transactions are always issued in order.
+ */
+void i2c_async_wait(void);
+
+/**
+ * \brief Dispatch the callbacks of completed transactions. Called periodically from the keyboard task.
+ */
+void i2c_async_task(void);
+#endif
+
 /** \} */
@@ -1,6 +1,7 @@
 // Copyright 2024 QMK
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
 #include "ws2812.h"
 
 #if defined(WS2812_RGBW)
@@ -13,3 +14,52 @@ void ws2812_rgb_to_rgbw(ws2812_led_t *led) {
     led->b -= led->w;
 }
 #endif
+
+bool ws2812_led_changed(ws2812_led_t *encoded, const ws2812_led_t *led) {
+    if (memcmp(encoded, led, sizeof(ws2812_led_t)) == 0) {
+        return false;
+    }
+    *encoded = *led;
+    return true;
+}
+
+#if defined(WS2812_SPI)
+#    define WS2812_SPI_BIT(bit) ((bit) ? 0b1110 : 0b1000)
+#    define WS2812_SPI_BIT_PAIR(bits) ((WS2812_SPI_BIT((bits) & 2) << 4) | WS2812_SPI_BIT((bits) & 1))
+#    define WS2812_SPI_NIBBLE(nibble) {WS2812_SPI_BIT_PAIR((nibble) >> 2), WS2812_SPI_BIT_PAIR(nibble)}
+
+// The SPI data for each nibble of a colour byte, MSB first.
+static const uint8_t ws2812_spi_nibbles[16][2] = {
+    WS2812_SPI_NIBBLE(0x0), WS2812_SPI_NIBBLE(0x1), WS2812_SPI_NIBBLE(0x2), WS2812_SPI_NIBBLE(0x3), //
+    WS2812_SPI_NIBBLE(0x4), WS2812_SPI_NIBBLE(0x5), WS2812_SPI_NIBBLE(0x6), WS2812_SPI_NIBBLE(0x7), //
+    WS2812_SPI_NIBBLE(0x8), WS2812_SPI_NIBBLE(0x9), WS2812_SPI_NIBBLE(0xA), WS2812_SPI_NIBBLE(0xB), //
+    WS2812_SPI_NIBBLE(0xC), WS2812_SPI_NIBBLE(0xD), WS2812_SPI_NIBBLE(0xE), WS2812_SPI_NIBBLE(0xF), //
+};
+
+void ws2812_spi_encode_led(uint8_t *dst, const ws2812_led_t *led) {
+    const uint8_t *bytes = (const uint8_t *)led;
+
+    for (uint8_t i = 0; i < sizeof(ws2812_led_t); i++) {
+        const uint8_t *high = ws2812_spi_nibbles[bytes[i] >> 4];
+        const uint8_t *low  = ws2812_spi_nibbles[bytes[i] & 0xF];
+
+        *dst++ = high[0];
+        *dst++ = high[1];
+        *dst++ = low[0];
+        *dst++ = low[1];
+    }
+}
+
+uint16_t ws2812_spi_encode_changed(uint8_t *dst, ws2812_led_t *encoded, const ws2812_led_t *leds, uint16_t count) {
+    uint16_t changed = 0;
+
+    for (uint16_t i = 0; i < count; i++) {
+        if (ws2812_led_changed(&encoded[i], &leds[i])) {
+            ws2812_spi_encode_led(&dst[i * 4 * sizeof(ws2812_led_t)], &leds[i]);
+            changed++;
+        }
+    }
+
+    return changed;
+}
+#endif
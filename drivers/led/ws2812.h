@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <stdint.h>
+#include <stdbool.h>
 #include "util.h"
 
 /*
@@ -95,3 +97,18 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
 void ws2812_flush(void);
 
 void ws2812_rgb_to_rgbw(ws2812_led_t *led);
+
+/*
+ * Shared by the drivers that send a prepared bitstream using DMA. The bytes of ws2812_led_t
+ * are already in wire order, so an LED is encoded by expanding its bytes MSB first.
+ */
+
+// Returns whether the LED differs from the colour encoded in the transmit buffer, and records it as encoded.
+bool ws2812_led_changed(ws2812_led_t *encoded, const ws2812_led_t *led);
+
+#if defined(WS2812_SPI)
+// Encodes one LED as SPI data, each WS2812 bit sent as four SPI bits (0b1110 or 0b1000).
+void ws2812_spi_encode_led(uint8_t *dst, const ws2812_led_t *led);
+// Encodes the LEDs whose colour changed since they were last encoded into this buffer. Returns how many were encoded.
+uint16_t ws2812_spi_encode_changed(uint8_t *dst, ws2812_led_t *encoded, const ws2812_led_t *leds, uint16_t count);
+#endif
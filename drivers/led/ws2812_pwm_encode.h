@@ -0,0 +1,36 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "ws2812.h"
+
+/*
+ * Encoding shared with the PWM driver, which sends one timer duty cycle per WS2812 bit. The width of a duty cycle in
+ * its frame buffer depends on the MCU and timer, so the includer typedefs ws2812_buffer_t first.
+ */
+
+// Encodes one LED as one duty cycle per bit, MSB first.
+static inline void ws2812_pwm_encode_led(ws2812_buffer_t *dst, const ws2812_led_t *led, const ws2812_buffer_t duty_cycles[2]) {
+    const uint8_t *bytes = (const uint8_t *)led;
+
+    for (uint8_t i = 0; i < sizeof(ws2812_led_t); i++) {
+        for (int8_t bit = 7; bit >= 0; bit--) {
+            *dst++ = duty_cycles[(bytes[i] >> bit) & 0x01];
+        }
+    }
+}
+
+// Encodes the LEDs whose colour changed since they were last encoded into this buffer. Returns how many were encoded.
+static inline uint16_t ws2812_pwm_encode_changed(ws2812_buffer_t *dst, ws2812_led_t *encoded, const ws2812_led_t *leds, uint16_t count, const ws2812_buffer_t duty_cycles[2]) {
+    uint16_t changed = 0;
+
+    for (uint16_t i = 0; i < count; i++) {
+        if (ws2812_led_changed(&encoded[i], &leds[i])) {
+            ws2812_pwm_encode_led(&dst[i * 8 * sizeof(ws2812_led_t)], &leds[i], duty_cycles);
+            changed++;
+        }
+    }
+
+    return changed;
+}
@@ -24,6 +24,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    endif
 #endif
 
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_OLED_ENABLE) && defined(SPLIT_OLED_MASTER_RENDER)
+#    include "keyboard.h"
+#    define OLED_RENDER_REMOTE
+#endif
+
 #include "compiler_support.h"
 #include "oled_driver.h"
 #include OLED_FONT_H
@@ -145,7 +150,14 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 // this is so we don't end up with rounding errors with
 // parts of the display unusable or don't get cleared correctly
 // and also allows for drawing & inverting
-uint8_t         oled_buffer[OLED_MATRIX_SIZE];
+#ifdef OLED_RENDER_REMOTE
+// The master also keeps the buffer of the other half, oled_buffer points at the one being drawn on
+static uint8_t         oled_buffers[2][OLED_MATRIX_SIZE];
+static OLED_BLOCK_TYPE oled_remote_dirty = OLED_ALL_BLOCKS_MASK;
+uint8_t *              oled_buffer       = oled_buffers[0];
+#else
+uint8_t oled_buffer[OLED_MATRIX_SIZE];
+#endif
 uint8_t *       oled_cursor;
 OLED_BLOCK_TYPE oled_dirty          = 0;
 bool            oled_initialized    = false;
@@ -187,8 +199,15 @@ uint16_t oled_update_timeout;
 #    endif
 #endif
 
+// Waits for the data handed to oled_send_data_async() to be sent
+static void oled_transfer_finish(void) {
+    while (oled_transfer_busy()) {
+    }
+}
+
 // Transmit/Write Funcs.
 __attribute__((weak)) bool oled_send_cmd(const uint8_t *data, uint16_t size) {
+    oled_transfer_finish();
 #if defined(OLED_TRANSPORT_SPI)
     if (!spi_start(OLED_CS_PIN, false, OLED_SPI_MODE, OLED_SPI_DIVISOR)) {
         return false;
@@ -211,6 +230,7 @@ __attribute__((weak)) bool oled_send_cmd(const uint8_t *data, uint16_t size) {
 
 __attribute__((weak)) bool oled_send_cmd_P(const uint8_t *data, uint16_t size) {
 #if defined(__AVR__)
+    oled_transfer_finish();
 #    if defined(OLED_TRANSPORT_SPI)
     if (!spi_start(OLED_CS_PIN, false, OLED_SPI_MODE, OLED_SPI_DIVISOR)) {
         return false;
@@ -236,6 +256,7 @@ __attribute__((weak)) bool oled_send_cmd_P(const uint8_t *data, uint16_t size) {
 }
 
 __attribute__((weak)) bool oled_send_data(const uint8_t *data, uint16_t size) {
+    oled_transfer_finish();
 #if defined(OLED_TRANSPORT_SPI)
     if (!spi_start(OLED_CS_PIN, false, OLED_SPI_MODE, OLED_SPI_DIVISOR)) {
         return false;
@@ -255,6 +276,46 @@ __attribute__((weak)) bool oled_send_data(const uint8_t *data, uint16_t size) {
 #endif
 }
 
+__attribute__((weak)) bool oled_send_data_async(const uint8_t *data, uint16_t size) {
+#if defined(OLED_TRANSPORT_SPI)
+    oled_transfer_finish();
+    if (!spi_start(OLED_CS_PIN, false, OLED_SPI_MODE, OLED_SPI_DIVISOR)) {
+        return false;
+    }
+    // Data Mode
+    gpio_write_pin_high(OLED_DC_PIN);
+    // Start sending, spi_stop() leaves CS asserted and the bus held until the transfer is complete
+    spi_status_t status = spi_transmit_async(data, size);
+    spi_stop();
+    return (status == SPI_STATUS_SUCCESS);
+#elif defined(OLED_TRANSPORT_I2C) && defined(I2C_ASYNC_ENABLE)
+    // Queue the data in chunks, each one continues from where the previous one ended in display RAM
+    while (size) {
+        uint16_t chunk = MIN(size, I2C_ASYNC_MAX_LENGTH - 1);
+        if (i2c_write_register_async((OLED_DISPLAY_ADDRESS << 1), I2C_DATA, data, chunk, NULL, NULL) != I2C_STATUS_SUCCESS) {
+            return false;
+        }
+        data += chunk;
+        size -= chunk;
+    }
+    return true;
+#else
+    return oled_send_data(data, size);
+#endif
+}
+
+__attribute__((weak)) bool oled_transfer_busy(void) {
+#if defined(OLED_TRANSPORT_SPI)
+    // Also releases the bus once the transfer is complete
+    return spi_transmit_busy();
+#elif defined(OLED_TRANSPORT_I2C) && defined(I2C_ASYNC_ENABLE)
+    i2c_async_task();
+    return i2c_async_busy();
+#else
+    return false;
+#endif
+}
+
 __attribute__((weak)) void oled_driver_init(void) {
 #if defined(OLED_TRANSPORT_SPI)
     spi_init();
@@ -379,7 +440,7 @@ __attribute__((weak)) oled_rotation_t oled_init_user(oled_rotation_t rotation) {
 }
 
 void oled_clear(void) {
-    memset(oled_buffer, 0, sizeof(oled_buffer));
+    memset(oled_buffer, 0, OLED_MATRIX_SIZE);
     oled_cursor = &oled_buffer[0];
     oled_dirty  = OLED_ALL_BLOCKS_MASK;
 }
@@ -433,19 +494,148 @@ static void calc_bounds_90(uint8_t update_start, uint8_t *cmd_array) {
 #endif
 }
 
-uint8_t crot(uint8_t a, int8_t n) {
-    const uint8_t mask = 0x7;
-    n &= mask;
-    return a << n | a >> (-n & mask);
+// Transposes an 8x8 pixel tile, so that dest[i] bit 7 - j is src[j] bit i
+static void rotate_90(const uint8_t *src, uint8_t *dest) {
+    uint32_t x = ((uint32_t)src[0] << 24) | ((uint32_t)src[1] << 16) | ((uint32_t)src[2] << 8) | src[3];
+    uint32_t y = ((uint32_t)src[4] << 24) | ((uint32_t)src[5] << 16) | ((uint32_t)src[6] << 8) | src[7];
+    uint32_t t;
+
+    // swap 1x1, 2x2 and then 4x4 bit squares
+    t = (x ^ (x >> 7)) & 0x00AA00AA;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;
+    y = y ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC;
+    y = y ^ t ^ (t << 14);
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+
+    dest[0] = y;
+    dest[1] = y >> 8;
+    dest[2] = y >> 16;
+    dest[3] = y >> 24;
+    dest[4] = x;
+    dest[5] = x >> 8;
+    dest[6] = x >> 16;
+    dest[7] = x >> 24;
 }
 
-static void rotate_90(const uint8_t *src, uint8_t *dest) {
-    for (uint8_t i = 0, shift = 7; i < 8; ++i, --shift) {
-        uint8_t selector = (1 << i);
-        for (uint8_t j = 0; j < 8; ++j) {
-            dest[i] |= crot(src[j] & selector, shift - (int8_t)j);
+#if OLED_IC_HAS_HORIZONTAL_MODE
+#    define OLED_MERGE_BLOCKS (OLED_DISPLAY_WIDTH % OLED_BLOCK_SIZE == 0 || OLED_BLOCK_SIZE % OLED_DISPLAY_WIDTH == 0)
+#else
+// Page Addressing Mode can't wrap to the next page, so a burst never spans more than one
+#    define OLED_MERGE_BLOCKS (OLED_DISPLAY_WIDTH % OLED_BLOCK_SIZE == 0)
+#endif
+
+// Renders a single block, used when rotated or when the blocks are not aligned to the pages
+static bool oled_render_block(uint8_t block) {
+    // Set column & page position
+#if OLED_IC_HAS_HORIZONTAL_MODE
+    static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
+#else
+    static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
+#endif
+    if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+        calc_bounds(block, &display_start[1]); // Offset from I2C_CMD byte at the start
+    } else {
+        calc_bounds_90(block, &display_start[1]); // Offset from I2C_CMD byte at the start
+    }
+
+    // Send column & page position
+    if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
+        print("oled_render offset command failed\n");
+        return false;
+    }
+
+    if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+        // Send render data chunk as is
+        if (!oled_send_data_async(&oled_buffer[OLED_BLOCK_SIZE * block], OLED_BLOCK_SIZE)) {
+            print("oled_render data failed\n");
+            return false;
+        }
+    } else {
+        // Rotate the render chunks
+        const static uint8_t source_map[] = OLED_SOURCE_MAP;
+        const static uint8_t target_map[] = OLED_TARGET_MAP;
+
+        // The previous burst may still be sent from here
+        oled_transfer_finish();
+        static uint8_t temp_buffer[OLED_BLOCK_SIZE];
+        memset(temp_buffer, 0, sizeof(temp_buffer));
+        for (uint8_t i = 0; i < sizeof(source_map); ++i) {
+            rotate_90(&oled_buffer[OLED_BLOCK_SIZE * block + source_map[i]], &temp_buffer[target_map[i]]);
+        }
+
+#if OLED_IC_HAS_HORIZONTAL_MODE
+        // Send render data chunk after rotating
+        if (!oled_send_data_async(&temp_buffer[0], OLED_BLOCK_SIZE)) {
+            print("oled_render90 data failed\n");
+            return false;
         }
+#else
+        // For SH1106 or SH1107 the data chunk must be split into separate pieces for each page
+        const uint8_t columns_in_block = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8;
+        const uint8_t num_pages        = OLED_BLOCK_SIZE / columns_in_block;
+        for (uint8_t i = 0; i < num_pages; ++i) {
+            // Send column & page position for all pages except the first one
+            if (i > 0) {
+                display_start[1]++;
+                if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
+                    print("oled_render offset command failed\n");
+                    return false;
+                }
+            }
+            // Send data for the page
+            if (!oled_send_data_async(&temp_buffer[columns_in_block * i], columns_in_block)) {
+                print("oled_render90 data failed\n");
+                return false;
+            }
+        }
+#endif
     }
+
+    return true;
+}
+
+// Renders the run of dirty blocks starting at first as a single window, returns the number of blocks rendered
+static uint8_t oled_render_burst(uint8_t first) {
+    uint8_t last = first;
+    while (last < OLED_BLOCK_COUNT - 1 && (oled_dirty & ((OLED_BLOCK_TYPE)1 << (last + 1)))) {
+        ++last;
+    }
+
+    uint16_t start  = OLED_BLOCK_SIZE * first;
+    uint16_t length = OLED_BLOCK_SIZE * (last - first + 1);
+    uint8_t  page   = start / OLED_DISPLAY_WIDTH;
+    uint8_t  column = start % OLED_DISPLAY_WIDTH;
+
+    if (column + length > OLED_DISPLAY_WIDTH) {
+        // A window either covers whole pages, or ends with the page it starts in
+        length = OLED_IC_HAS_HORIZONTAL_MODE && column == 0 ? length / OLED_DISPLAY_WIDTH * OLED_DISPLAY_WIDTH : OLED_DISPLAY_WIDTH - column;
+    }
+
+#if OLED_IC_HAS_HORIZONTAL_MODE
+    uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, OLED_COLUMN_OFFSET + column, OLED_COLUMN_OFFSET + column + MIN(length, OLED_DISPLAY_WIDTH) - 1, PAGE_ADDR, page, page + (length - 1) / OLED_DISPLAY_WIDTH};
+#else
+    uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR | page, PAM_SETCOLUMN_LSB | ((OLED_COLUMN_OFFSET + column) & 0x0f), PAM_SETCOLUMN_MSB | ((OLED_COLUMN_OFFSET + column) >> 4 & 0x0f)};
+#endif
+
+    // Send column & page position
+    if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
+        print("oled_render offset command failed\n");
+        return 0;
+    }
+
+    // Send the whole window at once, straight from the buffer
+    if (!oled_send_data_async(&oled_buffer[start], length)) {
+        print("oled_render data failed\n");
+        return 0;
+    }
+
+    return length / OLED_BLOCK_SIZE;
 }
 
 void oled_render_dirty(bool all) {
@@ -455,82 +645,40 @@ void oled_render_dirty(bool all) {
         return;
     }
 
+    // Let the previous burst complete in the background
+    if (!all && oled_transfer_busy()) {
+        return;
+    }
+
     // Turn on display if it is off
     oled_on();
 
     uint8_t update_start  = 0;
     uint8_t num_processed = 0;
-    while (oled_dirty && (num_processed++ < OLED_UPDATE_PROCESS_LIMIT || all)) { // render all dirty blocks (up to the configured limit)
+    while (oled_dirty && (num_processed++ < OLED_UPDATE_PROCESS_LIMIT || all)) { // render all dirty blocks (up to the configured limit of bursts)
         // Find next dirty block
         while (!(oled_dirty & ((OLED_BLOCK_TYPE)1 << update_start))) {
             ++update_start;
         }
 
-        // Set column & page position
-#if OLED_IC_HAS_HORIZONTAL_MODE
-        static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
-#else
-        static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
-#endif
-        if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            calc_bounds(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
-        } else {
-            calc_bounds_90(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
+        uint8_t rendered = 1;
+        if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90) && OLED_MERGE_BLOCKS) {
+            rendered = oled_render_burst(update_start);
+        } else if (!oled_render_block(update_start)) {
+            rendered = 0;
         }
-
-        // Send column & page position
-        if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
-            print("oled_render offset command failed\n");
+        if (!rendered) {
             return;
         }
 
-        if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            // Send render data chunk as is
-            if (!oled_send_data(&oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE)) {
-                print("oled_render data failed\n");
-                return;
-            }
-        } else {
-            // Rotate the render chunks
-            const static uint8_t source_map[] = OLED_SOURCE_MAP;
-            const static uint8_t target_map[] = OLED_TARGET_MAP;
-
-            static uint8_t temp_buffer[OLED_BLOCK_SIZE];
-            memset(temp_buffer, 0, sizeof(temp_buffer));
-            for (uint8_t i = 0; i < sizeof(source_map); ++i) {
-                rotate_90(&oled_buffer[OLED_BLOCK_SIZE * update_start + source_map[i]], &temp_buffer[target_map[i]]);
-            }
-
-#if OLED_IC_HAS_HORIZONTAL_MODE
-            // Send render data chunk after rotating
-            if (!oled_send_data(&temp_buffer[0], OLED_BLOCK_SIZE)) {
-                print("oled_render90 data failed\n");
-                return;
-            }
-#else
-            // For SH1106 or SH1107 the data chunk must be split into separate pieces for each page
-            const uint8_t columns_in_block = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8;
-            const uint8_t num_pages        = OLED_BLOCK_SIZE / columns_in_block;
-            for (uint8_t i = 0; i < num_pages; ++i) {
-                // Send column & page position for all pages except the first one
-                if (i > 0) {
-                    display_start[1]++;
-                    if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
-                        print("oled_render offset command failed\n");
-                        return;
-                    }
-                }
-                // Send data for the page
-                if (!oled_send_data(&temp_buffer[columns_in_block * i], columns_in_block)) {
-                    print("oled_render90 data failed\n");
-                    return;
-                }
-            }
-#endif
+        // Clear dirty flags of just rendered blocks
+        while (rendered--) {
+            oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start++);
         }
+    }
 
-        // Clear dirty flag of just rendered block
-        oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+    if (all) {
+        oled_transfer_finish();
     }
 }
 
@@ -926,20 +1074,93 @@ uint8_t oled_max_lines(void) {
     return OLED_DISPLAY_WIDTH / OLED_FONT_HEIGHT;
 }
 
+#ifdef OLED_RENDER_REMOTE
+static void oled_task_render_remote(void) {
+    uint8_t *       cursor = oled_cursor;
+    OLED_BLOCK_TYPE dirty  = oled_dirty;
+
+    oled_buffer = oled_buffers[1];
+    oled_dirty  = oled_remote_dirty;
+    oled_set_cursor(0, 0);
+    oled_task_remote_kb();
+    oled_remote_dirty = oled_dirty & OLED_ALL_BLOCKS_MASK;
+
+    oled_buffer = oled_buffers[0];
+    oled_dirty  = dirty;
+    oled_cursor = cursor;
+}
+
+const uint8_t *oled_remote_next_dirty_block(uint8_t *block) {
+    if (!oled_remote_dirty) {
+        return NULL;
+    }
+
+    uint8_t index = 0;
+    while (!(oled_remote_dirty & ((OLED_BLOCK_TYPE)1 << index))) {
+        index++;
+    }
+    oled_remote_dirty &= ~((OLED_BLOCK_TYPE)1 << index);
+    *block = index;
+    return &oled_buffers[1][OLED_BLOCK_SIZE * index];
+}
+
+void oled_remote_mark_dirty(uint8_t block) {
+    if (block >= OLED_BLOCK_COUNT) {
+        oled_remote_dirty = OLED_ALL_BLOCKS_MASK;
+    } else {
+        oled_remote_dirty |= ((OLED_BLOCK_TYPE)1 << block);
+    }
+}
+
+void oled_write_block(uint8_t block, const uint8_t *data) {
+    if (block >= OLED_BLOCK_COUNT) {
+        return;
+    }
+
+    uint8_t *target = &oled_buffer[OLED_BLOCK_SIZE * block];
+    if (memcmp(target, data, OLED_BLOCK_SIZE) != 0) {
+        memcpy(target, data, OLED_BLOCK_SIZE);
+        oled_dirty |= ((OLED_BLOCK_TYPE)1 << block);
+    }
+}
+
+__attribute__((weak)) bool oled_task_remote_kb(void) {
+    return oled_task_remote_user();
+}
+__attribute__((weak)) bool oled_task_remote_user(void) {
+    return true;
+}
+#endif
+
+static void oled_task_render(void) {
+#ifdef OLED_RENDER_REMOTE
+    // the master draws both displays, the other half only shows what it receives
+    if (!is_keyboard_master()) {
+        return;
+    }
+#endif
+    oled_set_cursor(0, 0);
+    oled_task_kb();
+#ifdef OLED_RENDER_REMOTE
+    oled_task_render_remote();
+#endif
+}
+
 void oled_task(void) {
     if (!oled_initialized) {
         return;
     }
 
+    // Release the bus as soon as the previous burst has been sent
+    oled_transfer_busy();
+
 #if OLED_UPDATE_INTERVAL > 0
     if (timer_elapsed(oled_update_timeout) >= OLED_UPDATE_INTERVAL) {
         oled_update_timeout = timer_read();
-        oled_set_cursor(0, 0);
-        oled_task_kb();
+        oled_task_render();
     }
 #else
-    oled_set_cursor(0, 0);
-    oled_task_kb();
+    oled_task_render();
 #endif
 
 #if OLED_SCROLL_TIMEOUT > 0
@@ -342,6 +342,9 @@ bool oled_init(oled_rotation_t rotation);
 bool oled_send_cmd(const uint8_t *data, uint16_t size);
 bool oled_send_cmd_P(const uint8_t *data, uint16_t size);
 bool oled_send_data(const uint8_t *data, uint16_t size);
+// Starts sending data without waiting for it to complete, data must stay valid until oled_transfer_busy() returns false
+bool oled_send_data_async(const uint8_t *data, uint16_t size);
+bool oled_transfer_busy(void);
 void oled_driver_init(void);
 
 // Called at the start of oled_init, weak function overridable by the user
@@ -450,6 +453,22 @@ void oled_task(void);
 bool oled_task_kb(void);
 bool oled_task_user(void);
 
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_OLED_ENABLE) && defined(SPLIT_OLED_MASTER_RENDER)
+// Called on the master right after oled_task_kb, to render the display of the other half.
+// All oled_write* calls made from here draw on the other half, only the changed blocks are sent over.
+bool oled_task_remote_kb(void);
+bool oled_task_remote_user(void);
+
+// Returns the next changed block of the other half's display and marks it as sent, or NULL if there is none
+const uint8_t *oled_remote_next_dirty_block(uint8_t *block);
+
+// Marks a block of the other half's display to be sent again, use OLED_BLOCK_COUNT to mark all of them
+void oled_remote_mark_dirty(uint8_t block);
+
+// Copies a block of OLED_BLOCK_SIZE bytes received from the master into the display buffer
+void oled_write_block(uint8_t block, const uint8_t *data);
+#endif
+
 // Set the specific 8 lines rows of the screen to scroll.
 // 0 is the default for start, and 7 for end, which is the entire
 // height of the screen.  For 128x32 screens, rows 4-7 are not used.
@@ -93,6 +93,27 @@ spi_status_t spi_read(void);
  */
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
+/**
+ * \brief Start sending multiple bytes to the selected SPI device, without waiting for the transfer to complete.
+ *
+ * Platforms without asynchronous transfers send the data before returning.
+ *
+ * \param data A pointer to the data to write from, which must stay valid until `spi_transmit_busy()` returns `false`.
+ * \param length The number of bytes to write. Take care not to overrun the length of `data`.
+ *
+ * \return `SPI_STATUS_ERROR` if the transfer could not be started, otherwise `SPI_STATUS_SUCCESS`.
+ */
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length);
+
+/**
+ * \brief Check whether a transfer started by `spi_transmit_async()` is still in progress.
+ *
+ * On ChibiOS, once the transfer is complete this also finishes a `spi_stop()` that was deferred by it.
+ *
+ * \return `true` until the transfer completes.
+ */
+bool spi_transmit_busy(void);
+
 /**
  * \brief Receive multiple bytes from the selected SPI device.
  *
@@ -106,6 +127,7 @@ spi_status_t spi_receive(uint8_t *data, uint16_t length);
 /**
  * \brief End the current SPI transaction. This will deassert the slave select pin and reset the endianness, mode and divisor configured by `spi_start()`.
  *
+ * If a transfer started by `spi_transmit_async()` is still in progress, the slave stays selected and the bus stays held until it completes. The transaction is then ended by the next call to `spi_start()` (which waits for the transfer) or `spi_transmit_busy()` from the same thread.
  */
 void spi_stop(void);
 
@@ -12,6 +12,9 @@ from qmk.keyboard import keyboard_completer, keyboard_folder
 from qmk.path import normpath
 from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE, JOYSTICK_AXES
 
+# Checked against RGB_MATRIX_LED_NEIGHBOUR_RADIUS and LED_MATRIX_LED_NEIGHBOUR_RADIUS in the generated code
+LED_NEIGHBOUR_RADIUS = 40
+
 
 def _gen_led_configs(info_data):
     lines = []
@@ -60,12 +63,115 @@ def _gen_led_config(info_data, config_type):
     lines.append(f'  {{ {", ".join(pos)} }},')
     lines.append(f'  {{ {", ".join(flags)} }},')
     lines.append('};')
+    lines.extend(_gen_led_geometry(info_data, config_type))
     lines.append('#endif')
     lines.append('')
 
     return lines
 
 
+def _sqrt16(x):
+    """Port of lib8tion's sqrt16(), including the truncation of its argument to 16 bits
+    """
+    x &= 0xFFFF
+    if x <= 1:
+        return x
+
+    low = 1
+    hi = 255 if x > 7904 else (x >> 5) + 8
+    while hi >= low:
+        mid = (low + hi) >> 1
+        if mid * mid > x:
+            hi = mid - 1
+        else:
+            if mid == 255:
+                return 255
+            low = mid + 1
+
+    return low - 1
+
+
+def _atan2_8(dy, dx):
+    """Port of lib8tion's atan2_8()
+    """
+    def div(a, b):
+        # C integer division truncates towards zero
+        q = abs(a) // abs(b)
+        return q if (a < 0) == (b < 0) else -q
+
+    if dy == 0:
+        return 0 if dx >= 0 else 128
+
+    abs_y = abs(dy)
+    if dx >= 0:
+        a = 32 - div(32 * (dx - abs_y), dx + abs_y)
+    else:
+        a = 96 - div(32 * (dx + abs_y), abs_y - dx)
+
+    return -a & 0xFF if dy < 0 else a & 0xFF
+
+
+def _gen_led_geometry(info_data, config_type):
+    """Derive the LED geometry tables from g_led_config, so effects can look them up instead of computing them every frame
+    """
+    led_layout = info_data[config_type]['layout']
+    center_x, center_y = info_data[config_type].get('center_point', [112, 32])
+    points = [(led_data.get('x', 0), led_data.get('y', 0)) for led_data in led_layout]
+    prefix = 'RGB_MATRIX' if config_type == 'rgb_matrix' else 'LED_MATRIX'
+
+    lines = []
+    lines.append(f'#ifdef {prefix}_LED_GEOMETRY')
+    lines.append(f'_Static_assert({prefix}_LED_NEIGHBOUR_RADIUS == {LED_NEIGHBOUR_RADIUS}, "g_led_neighbours was generated for a different {prefix}_LED_NEIGHBOUR_RADIUS");')
+
+    # the center is a brace list, which C can only compare once the optimizer has folded it
+    lines.append(f'#if defined({prefix}_CENTER) && defined(__OPTIMIZE__)')
+    lines.append(f'extern void {config_type}_center_mismatch(void) __attribute__((error("{prefix}_CENTER does not match the center_point g_led_geometry was generated for")));')
+    lines.append(f'static void __attribute__((used)) {config_type}_check_center(void) {{')
+    lines.append(f'    if (((led_point_t){prefix}_CENTER).x != {center_x} || ((led_point_t){prefix}_CENTER).y != {center_y}) {config_type}_center_mismatch();')
+    lines.append('}')
+    lines.append('#endif')
+
+    # offsets from the center point, as used by the dx/dy effect runners
+    geometry = []
+    for x, y in points:
+        dx = x - center_x
+        dy = y - center_y
+        geometry.append(f'{{{dx}, {dy}, {_sqrt16(dx * dx + dy * dy)}, {_atan2_8(dy, dx)}}}')
+    lines.append('const led_geometry_t PROGMEM g_led_geometry[] = {')
+    lines.append(f'  {", ".join(geometry)}')
+    lines.append('};')
+
+    # reverse of matrix_co
+    keys = []
+    for led_data in led_layout:
+        row, col = led_data.get('matrix', ['NO_LED', 'NO_LED'])
+        keys.append(f'{{.col = {col}, .row = {row}}}')
+    lines.append('const keypos_t PROGMEM g_led_key[] = {')
+    lines.append(f'  {", ".join(keys)}')
+    lines.append('};')
+
+    # other LEDs within LED_NEIGHBOUR_RADIUS of each LED, closest first
+    neighbours = []
+    neighbour_offsets = [0]
+    for index, (x, y) in enumerate(points):
+        distances = []
+        for other, (other_x, other_y) in enumerate(points):
+            dx = x - other_x
+            dy = y - other_y
+            distance = _sqrt16(dx * dx + dy * dy)
+            if other != index and distance <= LED_NEIGHBOUR_RADIUS:
+                distances.append((distance, other))
+        neighbours.extend(f'{{{other}, {distance}}}' for distance, other in sorted(distances))
+        neighbour_offsets.append(len(neighbours))
+    lines.append('const led_neighbour_t PROGMEM g_led_neighbours[] = {')
+    lines.append(f'  {", ".join(neighbours) or "{NO_LED, 0}"}')
+    lines.append('};')
+    lines.append(f'const uint16_t PROGMEM g_led_neighbours_offset[] = {{ {", ".join(map(str, neighbour_offsets))} }};')
+    lines.append('#endif')
+
+    return lines
+
+
 def _gen_matrix_mask(info_data):
     """Convert info.json content to matrix_mask
     """
@@ -0,0 +1,85 @@
+from qmk.cli.generate.keyboard_c import LED_NEIGHBOUR_RADIUS, _atan2_8, _gen_led_geometry, _sqrt16
+
+
+def test_sqrt16():
+    # lib8tion's sqrt16() rounds down and is capped at 255
+    for x, root in [(0, 0), (1, 1), (2, 1), (3, 1), (4, 2), (255, 15), (7904, 88), (7905, 88), (65024, 254), (65025, 255), (65535, 255)]:
+        assert _sqrt16(x) == root
+
+    # its argument is a uint16_t
+    assert _sqrt16(65536) == 0
+    assert _sqrt16(65537) == 1
+
+
+def test_atan2_8():
+    # full circle is 256, counter-clockwise from the positive x axis
+    for dy, dx, angle in [(0, 0, 0), (0, 5, 0), (1, 1, 32), (1, 0, 64), (0, -5, 128), (-1, -1, 160), (-1, 0, 192), (3, 4, 28), (-40, 30, 220)]:
+        assert _atan2_8(dy, dx) == angle
+
+
+def test_gen_led_geometry_layout():
+    info_data = {
+        'rgb_matrix': {
+            'layout': [
+                {
+                    'matrix': [0, 0],
+                    'x': 112,
+                    'y': 32,
+                    'flags': 4
+                },
+                {
+                    'matrix': [0, 1],
+                    'x': 132,
+                    'y': 32,
+                    'flags': 5
+                },
+                {
+                    'x': 200,
+                    'y': 32,
+                    'flags': 2
+                },
+            ],
+        },
+    }
+    lines = _gen_led_geometry(info_data, 'rgb_matrix')
+
+    assert lines[0] == '#ifdef RGB_MATRIX_LED_GEOMETRY'
+    assert f'_Static_assert(RGB_MATRIX_LED_NEIGHBOUR_RADIUS == {LED_NEIGHBOUR_RADIUS}, ' in lines[1]
+    assert '    if (((led_point_t)RGB_MATRIX_CENTER).x != 112 || ((led_point_t)RGB_MATRIX_CENTER).y != 32) rgb_matrix_center_mismatch();' in lines
+    assert lines[-1] == '#endif'
+
+    # dx, dy, dist and angle from the default center point
+    assert lines[lines.index('const led_geometry_t PROGMEM g_led_geometry[] = {') + 1] == '  {0, 0, 0, 0}, {20, 0, 20, 0}, {88, 0, 88, 0}'
+    assert lines[lines.index('const keypos_t PROGMEM g_led_key[] = {') + 1] == '  {.col = 0, .row = 0}, {.col = 1, .row = 0}, {.col = NO_LED, .row = NO_LED}'
+
+    # LED 2 is further than LED_NEIGHBOUR_RADIUS from the others
+    assert lines[lines.index('const led_neighbour_t PROGMEM g_led_neighbours[] = {') + 1] == '  {1, 20}, {0, 20}'
+    assert 'const uint16_t PROGMEM g_led_neighbours_offset[] = { 0, 1, 2, 2 };' in lines
+
+
+def test_gen_led_geometry_center_point():
+    info_data = {
+        'led_matrix': {
+            'center_point': [100, 30],
+            'layout': [
+                {
+                    'x': 90,
+                    'y': 40,
+                    'flags': 1
+                },
+                {
+                    'x': 100,
+                    'y': 40,
+                    'flags': 1
+                },
+            ],
+        },
+    }
+    lines = _gen_led_geometry(info_data, 'led_matrix')
+
+    assert lines[0] == '#ifdef LED_MATRIX_LED_GEOMETRY'
+    assert '    if (((led_point_t)LED_MATRIX_CENTER).x != 100 || ((led_point_t)LED_MATRIX_CENTER).y != 30) led_matrix_center_mismatch();' in lines
+    assert lines[lines.index('const led_geometry_t PROGMEM g_led_geometry[] = {') + 1] == f'  {{-10, 10, 14, {_atan2_8(10, -10)}}}, {{0, 10, 10, 64}}'
+
+    # each LED lists the other as its neighbour
+    assert lines[lines.index('const led_neighbour_t PROGMEM g_led_neighbours[] = {') + 1] == '  {1, 10}, {0, 10}'
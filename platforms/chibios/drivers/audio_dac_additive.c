@@ -17,8 +17,8 @@
 
 #include "audio.h"
 #include "gpio.h"
-#include <math.h>
 #include "util.h"
+#include "compiler_support.h"
 
 // Need to disable GCC's "tautological-compare" warning for this file, as it causes issues when running `KEEP_INTERMEDIATES=yes`. Corresponding pop at the end of the file.
 #pragma GCC diagnostic push
@@ -88,13 +88,35 @@ static const dacsample_t dac_buffer_trapezoid[] = {
 };
 #endif // AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID
 
+#if defined(AUDIO_DAC_SAMPLE_WAVEFORM_SINE)
+#    define DAC_WAVETABLE dac_buffer_sine
+#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRIANGLE)
+#    define DAC_WAVETABLE dac_buffer_triangle
+#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID)
+#    define DAC_WAVETABLE dac_buffer_trapezoid
+#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_SQUARE)
+#    define DAC_WAVETABLE dac_buffer_square
+#endif
+
+#define DAC_WAVETABLE_LENGTH ARRAY_SIZE(DAC_WAVETABLE)
+STATIC_ASSERT((DAC_WAVETABLE_LENGTH & (DAC_WAVETABLE_LENGTH - 1)) == 0, "DAC wavetable length must be a power of two");
+
+/* phase accumulators are 16.16 fixed-point indices into the wavetable, the
+ * 2/3 are necessary to get the correct frequencies on the DAC output (as
+ * measured with an oscilloscope), since the gpt timer runs with
+ * 3*AUDIO_DAC_SAMPLE_RATE; and the DAC callback is called twice per conversion.
+ */
+#define DAC_PHASE_SHIFT 16
+#define DAC_PHASE_INCREMENT(frequency) ((uint32_t)(((uint64_t)(frequency) * DAC_WAVETABLE_LENGTH * 2 << (DAC_PHASE_SHIFT - VOICE_FREQUENCY_SHIFT)) / (3 * AUDIO_DAC_SAMPLE_RATE)))
+
 static dacsample_t dac_buffer[AUDIO_DAC_BUFFER_SIZE];
 
-/* keep track of the sample position for for each frequency */
-static float dac_if[AUDIO_MAX_SIMULTANEOUS_TONES] = {0.0};
+/* keep track of the sample position for each frequency */
+static uint32_t dac_phase[AUDIO_MAX_SIMULTANEOUS_TONES] = {0};
 
-static float   active_tones_snapshot[AUDIO_MAX_SIMULTANEOUS_TONES] = {0};
-static uint8_t active_tones_snapshot_length                        = 0;
+/* per-sample phase increment of each sounding tone, only recomputed when the set of tones changes */
+static uint32_t active_tones_snapshot[AUDIO_MAX_SIMULTANEOUS_TONES] = {0};
+static uint8_t  active_tones_snapshot_length                        = 0;
 
 typedef enum {
     OUTPUT_SHOULD_START,
@@ -123,64 +145,23 @@ __attribute__((weak)) uint16_t dac_value_generate(void) {
     }
 
     /* doing additive wave synthesis over all currently playing tones = adding up
-     * sine-wave-samples for each frequency, scaled by the number of active tones
+     * wavetable-samples for each frequency, scaled by the number of active tones
      */
-    uint_fast16_t value     = 0;
-    float         frequency = 0.0f;
+    uint_fast32_t value = 0;
 
-#if defined(AUDIO_DAC_SAMPLE_WAVEFORM_SINE)
-    const size_t wavetable_length = ARRAY_SIZE(dac_buffer_sine);
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRIANGLE)
-    const size_t wavetable_length = ARRAY_SIZE(dac_buffer_triangle);
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID)
-    const size_t wavetable_length = ARRAY_SIZE(dac_buffer_trapezoid);
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_SQUARE)
-    const size_t wavetable_length = ARRAY_SIZE(dac_buffer_square);
-#endif
-
-    for (size_t i = 0; i < active_tones_snapshot_length; i++) {
+    for (uint8_t i = 0; i < active_tones_snapshot_length; i++) {
         /* Note: a user implementation does not have to rely on the active_tones_snapshot, but
-         * could directly query the active frequencies through audio_get_processed_frequency */
-        frequency = active_tones_snapshot[i];
-
-        float new_dac_if = dac_if[i];
-        new_dac_if += frequency * ((float)wavetable_length / AUDIO_DAC_SAMPLE_RATE * 2.0f / 3.0f);
-        /*Note: the 2/3 are necessary to get the correct frequencies on the
-         *      DAC output (as measured with an oscilloscope), since the gpt
-         *      timer runs with 3*AUDIO_DAC_SAMPLE_RATE; and the DAC callback
-         *      is called twice per conversion.*/
-
-        while (new_dac_if >= wavetable_length)
-            new_dac_if -= wavetable_length;
-        dac_if[i] = new_dac_if;
-
-        // Wavetable generation/lookup
-        size_t dac_i = (size_t)new_dac_if;
+         * could directly query the active frequencies through audio_get_processed_frequency_fixed */
+        dac_phase[i] += active_tones_snapshot[i];
 
-#if defined(AUDIO_DAC_SAMPLE_WAVEFORM_SINE)
-        value += dac_buffer_sine[dac_i] / active_tones_snapshot_length;
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRIANGLE)
-        value += dac_buffer_triangle[dac_i] / active_tones_snapshot_length;
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID)
-        value += dac_buffer_trapezoid[dac_i] / active_tones_snapshot_length;
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_SQUARE)
-        value += dac_buffer_square[dac_i] / active_tones_snapshot_length;
-#endif
-        /*
-        // SINE
-        value += dac_buffer_sine[dac_i] / active_tones_snapshot_length / 3;
-        // TRIANGLE
-        value += dac_buffer_triangle[dac_i] / active_tones_snapshot_length / 3;
-        // SQUARE
-        value += dac_buffer_square[dac_i] / active_tones_snapshot_length / 3;
-        //NOTE: combination of these three wave-forms is more exemplary - and doesn't sound particularly good :-P
-        */
+        // Wavetable lookup, the power-of-two length lets the index wrap for free
+        value += DAC_WAVETABLE[(dac_phase[i] >> DAC_PHASE_SHIFT) & (DAC_WAVETABLE_LENGTH - 1)];
 
         // STAIRS (mostly usefully as test-pattern)
-        // value_avg = dac_buffer_staircase[dac_i] / active_tones_snapshot_length;
+        // value += dac_buffer_staircase[(dac_phase[i] >> DAC_PHASE_SHIFT) & 3];
     }
 
-    return value;
+    return value / active_tones_snapshot_length;
 }
 
 /**
@@ -241,9 +222,9 @@ static void dac_end(DACDriver *dacp) {
             // update the snapshot - once, and only on occasion that something changed;
             // -> saves cpu cycles (?)
             for (uint8_t i = 0; i < active_tones; i++) {
-                float freq = audio_get_processed_frequency(i);
-                if (freq > 0) { // disregard 'rest' notes, with valid frequency 0.0f; which would only lower the resulting waveform volume during the additive synthesis step
-                    active_tones_snapshot[active_tones_snapshot_length++] = freq;
+                uint32_t freq = audio_get_processed_frequency_fixed(i);
+                if (freq > 0) { // disregard 'rest' notes, with valid frequency 0; which would only lower the resulting waveform volume during the additive synthesis step
+                    active_tones_snapshot[active_tones_snapshot_length++] = DAC_PHASE_INCREMENT(freq);
                 }
             }
 
@@ -358,8 +339,8 @@ void audio_driver_start_impl(void) {
     gptStartContinuous(&GPTD6, 2U);
 
     for (uint8_t i = 0; i < AUDIO_MAX_SIMULTANEOUS_TONES; i++) {
-        dac_if[i]                = 0.0f;
-        active_tones_snapshot[i] = 0.0f;
+        dac_phase[i]             = 0;
+        active_tones_snapshot[i] = 0;
     }
     active_tones_snapshot_length = 0;
     state                        = OUTPUT_SHOULD_START;
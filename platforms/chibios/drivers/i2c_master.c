@@ -31,6 +31,7 @@
 #include "chibios_config.h"
 #include <ch.h>
 #include <hal.h>
+#include <string.h>
 
 #ifndef I2C_DRIVER
 #    define I2C_DRIVER I2CD1
@@ -90,6 +91,24 @@
 #    endif
 #endif
 
+#ifdef I2C_ASYNC_ENABLE
+#    ifndef I2C_ASYNC_TIMEOUT
+#        define I2C_ASYNC_TIMEOUT 100
+#    endif
+#    ifndef I2C_ASYNC_THREAD_PRIORITY
+#        define I2C_ASYNC_THREAD_PRIORITY (NORMALPRIO + 1)
+#    endif
+// Only the thread that owns the queue needs to wait for it, and only it may run the callbacks.
+#    define I2C_ASYNC_BARRIER()                          \
+        do {                                             \
+            if (chThdGetSelfX() == i2c_async_owner) {    \
+                i2c_async_wait();                        \
+            }                                            \
+        } while (0)
+#else
+#    define I2C_ASYNC_BARRIER()
+#endif
+
 static const I2CConfig i2cconfig = {
 #if defined(USE_I2CV1_CONTRIB)
     I2C1_CLOCK_SPEED,
@@ -107,27 +126,164 @@ static const I2CConfig i2cconfig = {
 #endif
 };
 
+/**
+ * @brief Takes the bus, when it may be shared between threads, and starts the
+ * I2C peripheral. Every call must be paired with i2c_epilogue().
+ */
+static void i2c_prologue(void) {
+#if (I2C_USE_MUTUAL_EXCLUSION == TRUE)
+    i2cAcquireBus(&I2C_DRIVER);
+#endif
+    i2cStart(&I2C_DRIVER, &i2cconfig);
+}
+
 /**
  * @brief Handles any I2C error condition by stopping the I2C peripheral and
- * aborting any ongoing transactions. Furthermore ChibiOS status codes are
- * converted into QMK codes.
+ * aborting any ongoing transactions, then releases the bus. Furthermore
+ * ChibiOS status codes are converted into QMK codes.
  *
  * @param status ChibiOS specific I2C status code
  * @return i2c_status_t QMK specific I2C status code
  */
 static i2c_status_t i2c_epilogue(const msg_t status) {
+    if (status != MSG_OK) {
+        // From ChibiOS HAL: "After a timeout the driver must be stopped and
+        // restarted because the bus is in an uncertain state." We also issue that
+        // hard stop in case of any error.
+        i2cStop(&I2C_DRIVER);
+    }
+
+#if (I2C_USE_MUTUAL_EXCLUSION == TRUE)
+    i2cReleaseBus(&I2C_DRIVER);
+#endif
+
     if (status == MSG_OK) {
         return I2C_STATUS_SUCCESS;
     }
+    return status == MSG_TIMEOUT ? I2C_STATUS_TIMEOUT : I2C_STATUS_ERROR;
+}
 
-    // From ChibiOS HAL: "After a timeout the driver must be stopped and
-    // restarted because the bus is in an uncertain state." We also issue that
-    // hard stop in case of any error.
-    i2cStop(&I2C_DRIVER);
+#ifdef I2C_ASYNC_ENABLE
+typedef struct {
+    i2c_async_callback_t callback;
+    void*                arg;
+    i2c_status_t         status;
+    uint8_t              address;
+    uint16_t             length;
+    uint8_t              data[I2C_ASYNC_MAX_LENGTH];
+} i2c_async_transaction_t;
 
-    return status == MSG_TIMEOUT ? I2C_STATUS_TIMEOUT : I2C_STATUS_ERROR;
+// Transactions are queued at `head` by the main thread, transmitted at `tail`
+// by the worker thread, and reported at `reap` by the main thread. Each index
+// is only ever written by one thread.
+static i2c_async_transaction_t i2c_async_queue[I2C_ASYNC_QUEUE_SIZE];
+static volatile uint8_t        i2c_async_head = 0;
+static volatile uint8_t        i2c_async_tail = 0;
+static volatile uint8_t        i2c_async_reap = 0;
+static semaphore_t             i2c_async_pending;
+static binary_semaphore_t      i2c_async_completed;
+static thread_t*               i2c_async_owner = NULL;
+
+#    define I2C_ASYNC_NEXT(index) ((uint8_t)(((index) + 1) % I2C_ASYNC_QUEUE_SIZE))
+
+/**
+ * @brief This thread transmits queued transactions, sleeping while the I2C
+ * peripheral (and its DMA channel) moves the data.
+ */
+static THD_WORKING_AREA(waI2cAsyncThread, 256);
+static THD_FUNCTION(I2cAsyncThread, arg) {
+    (void)arg;
+    chRegSetThreadName("i2c_async");
+
+    while (true) {
+        chSemWait(&i2c_async_pending);
+
+        i2c_async_transaction_t* transaction = &i2c_async_queue[i2c_async_tail];
+
+        i2c_prologue();
+        msg_t status        = i2cMasterTransmitTimeout(&I2C_DRIVER, (transaction->address >> 1), transaction->data, transaction->length, 0, 0, TIME_MS2I(I2C_ASYNC_TIMEOUT));
+        transaction->status = i2c_epilogue(status);
+
+        i2c_async_tail = I2C_ASYNC_NEXT(i2c_async_tail);
+        chBSemSignal(&i2c_async_completed);
+    }
 }
 
+/**
+ * @brief Reports the oldest completed transaction, if any. The slot is
+ * released before the callback runs, so callbacks may queue more work.
+ */
+static bool i2c_async_reap_one(void) {
+    if (i2c_async_reap == i2c_async_tail) {
+        return false;
+    }
+
+    i2c_async_transaction_t* transaction = &i2c_async_queue[i2c_async_reap];
+    i2c_async_callback_t     callback    = transaction->callback;
+    void*                    arg         = transaction->arg;
+    i2c_status_t             status      = transaction->status;
+
+    i2c_async_reap = I2C_ASYNC_NEXT(i2c_async_reap);
+
+    if (callback) {
+        callback(status, arg);
+    }
+    return true;
+}
+
+static i2c_status_t i2c_async_enqueue(uint8_t address, const uint8_t* prefix, uint16_t prefix_length, const uint8_t* data, uint16_t length, i2c_async_callback_t callback, void* arg) {
+    if (prefix_length + length > I2C_ASYNC_MAX_LENGTH) {
+        return I2C_STATUS_ERROR;
+    }
+
+    // Queue full, wait for the worker thread to free up a slot.
+    while (I2C_ASYNC_NEXT(i2c_async_head) == i2c_async_reap) {
+        if (!i2c_async_reap_one()) {
+            chBSemWait(&i2c_async_completed);
+        }
+    }
+
+    i2c_async_transaction_t* transaction = &i2c_async_queue[i2c_async_head];
+    transaction->callback                = callback;
+    transaction->arg                     = arg;
+    transaction->address                 = address;
+    transaction->length                  = prefix_length + length;
+    if (prefix_length) {
+        memcpy(transaction->data, prefix, prefix_length);
+    }
+    memcpy(transaction->data + prefix_length, data, length);
+
+    i2c_async_head = I2C_ASYNC_NEXT(i2c_async_head);
+    chSemSignal(&i2c_async_pending);
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_transmit_async(uint8_t address, const uint8_t* data, uint16_t length, i2c_async_callback_t callback, void* arg) {
+    return i2c_async_enqueue(address, NULL, 0, data, length, callback, arg);
+}
+
+i2c_status_t i2c_write_register_async(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, i2c_async_callback_t callback, void* arg) {
+    return i2c_async_enqueue(devaddr, &regaddr, 1, data, length, callback, arg);
+}
+
+bool i2c_async_busy(void) {
+    return i2c_async_reap != i2c_async_head;
+}
+
+void i2c_async_wait(void) {
+    while (i2c_async_busy()) {
+        if (!i2c_async_reap_one()) {
+            chBSemWait(&i2c_async_completed);
+        }
+    }
+}
+
+void i2c_async_task(void) {
+    while (i2c_async_reap_one()) {
+    }
+}
+#endif
+
 __attribute__((weak)) void i2c_init(void) {
     static bool is_initialised = false;
     if (!is_initialised) {
@@ -145,23 +301,33 @@ __attribute__((weak)) void i2c_init(void) {
         palSetLineMode(I2C1_SCL_PIN, PAL_MODE_ALTERNATE(I2C1_SCL_PAL_MODE) | PAL_OUTPUT_TYPE_OPENDRAIN);
         palSetLineMode(I2C1_SDA_PIN, PAL_MODE_ALTERNATE(I2C1_SDA_PAL_MODE) | PAL_OUTPUT_TYPE_OPENDRAIN);
 #endif
+
+#ifdef I2C_ASYNC_ENABLE
+        i2c_async_owner = chThdGetSelfX();
+        chSemObjectInit(&i2c_async_pending, 0);
+        chBSemObjectInit(&i2c_async_completed, true);
+        chThdCreateStatic(waI2cAsyncThread, sizeof(waI2cAsyncThread), I2C_ASYNC_THREAD_PRIORITY, I2cAsyncThread, NULL);
+#endif
     }
 }
 
 i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    I2C_ASYNC_BARRIER();
+    i2c_prologue();
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    I2C_ASYNC_BARRIER();
+    i2c_prologue();
     msg_t status = i2cMasterReceiveTimeout(&I2C_DRIVER, (address >> 1), data, length, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    I2C_ASYNC_BARRIER();
+    i2c_prologue();
 
     uint8_t complete_packet[length + 1];
     for (uint16_t i = 0; i < length; i++) {
@@ -174,7 +340,8 @@ i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t*
 }
 
 i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    I2C_ASYNC_BARRIER();
+    i2c_prologue();
 
     uint8_t complete_packet[length + 2];
     for (uint16_t i = 0; i < length; i++) {
@@ -188,13 +355,15 @@ i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8
 }
 
 i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    I2C_ASYNC_BARRIER();
+    i2c_prologue();
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), &regaddr, 1, data, length, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    I2C_ASYNC_BARRIER();
+    i2c_prologue();
     uint8_t register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
     msg_t   status             = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), register_packet, 2, data, length, TIME_MS2I(timeout));
     return i2c_epilogue(status);
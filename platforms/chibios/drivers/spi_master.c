@@ -60,6 +60,11 @@
 #endif
 
 static bool spiStarted = false;
+// Set by spi_stop() while an asynchronous transfer is still in flight
+static bool spiStopDeferred = false;
+#if (SPI_USE_MUTUAL_EXCLUSION == TRUE)
+static thread_t *spiStopDeferredOwner = NULL;
+#endif
 #if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
 static pin_t current_slave_pin     = NO_PIN;
 static bool  current_cs_active_low = true;
@@ -124,7 +129,33 @@ __attribute__((weak)) void spi_init(void) {
     }
 }
 
+static inline bool spi_transfer_active(void) {
+    return SPI_DRIVER.state == SPI_ACTIVE;
+}
+
+// Ends the transaction left behind by spi_stop() once its transfer is complete, only the thread holding the bus may release it
+static void spi_complete_deferred_stop(bool wait) {
+    if (!spiStopDeferred) {
+        return;
+    }
+#if (SPI_USE_MUTUAL_EXCLUSION == TRUE)
+    if (spiStopDeferredOwner != chThdGetSelfX()) {
+        return;
+    }
+#endif
+    while (spi_transfer_active()) {
+        if (!wait) {
+            return;
+        }
+    }
+    spiStopDeferred = false;
+    spi_stop();
+}
+
 bool spi_start_extended(spi_start_config_t *start_config) {
+    // Wait for a transfer started by this thread with spi_transmit_async(), other threads block on the bus until it is released
+    spi_complete_deferred_stop(true);
+
 #if (SPI_USE_MUTUAL_EXCLUSION == TRUE)
     spiAcquireBus(&SPI_DRIVER);
 #endif // (SPI_USE_MUTUAL_EXCLUSION == TRUE)
@@ -455,6 +486,19 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+bool spi_transmit_busy(void) {
+    if (spi_transfer_active()) {
+        return true;
+    }
+    spi_complete_deferred_stop(false);
+    return false;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
@@ -462,6 +506,14 @@ spi_status_t spi_receive(uint8_t *data, uint16_t length) {
 
 void spi_stop(void) {
     if (spiStarted) {
+        if (spi_transfer_active()) {
+            // Keep the slave selected and the bus held until the transfer is complete
+            spiStopDeferred = true;
+#if (SPI_USE_MUTUAL_EXCLUSION == TRUE)
+            spiStopDeferredOwner = chThdGetSelfX();
+#endif
+            return;
+        }
         spi_unselect();
         spiStop(&SPI_DRIVER);
         spiStarted = false;
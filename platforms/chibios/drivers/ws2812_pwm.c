@@ -290,7 +290,12 @@ typedef uint8_t ws2812_buffer_t;
 typedef uint8_t ws2812_buffer_t;
 #endif
 
+#include "ws2812_pwm_encode.h"
+
 static ws2812_buffer_t ws2812_frame_buffer[WS2812_BIT_N + 1]; /**< Buffer for a frame */
+static ws2812_led_t    ws2812_encoded_leds[WS2812_LED_COUNT]; /**< Colours currently in the frame buffer */
+
+static const ws2812_buffer_t ws2812_duty_cycles[2] = {WS2812_DUTYCYCLE_0, WS2812_DUTYCYCLE_1};
 
 /* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 /*
@@ -372,26 +377,6 @@ void ws2812_init(void) {
     pwmEnableChannel(&WS2812_PWM_DRIVER, WS2812_PWM_CHANNEL - 1, 0); // Initial period is 0; output will be low until first duty cycle is DMA'd in
 }
 
-void ws2812_write_led(uint16_t led_number, uint8_t r, uint8_t g, uint8_t b) {
-    // Write color to frame buffer
-    for (uint8_t bit = 0; bit < 8; bit++) {
-        ws2812_frame_buffer[WS2812_RED_BIT(led_number, bit)]   = ((r >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_GREEN_BIT(led_number, bit)] = ((g >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_BLUE_BIT(led_number, bit)]  = ((b >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-    }
-}
-void ws2812_write_led_rgbw(uint16_t led_number, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
-    // Write color to frame buffer
-    for (uint8_t bit = 0; bit < 8; bit++) {
-        ws2812_frame_buffer[WS2812_RED_BIT(led_number, bit)]   = ((r >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_GREEN_BIT(led_number, bit)] = ((g >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_BLUE_BIT(led_number, bit)]  = ((b >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-#ifdef WS2812_RGBW
-        ws2812_frame_buffer[WS2812_WHITE_BIT(led_number, bit)] = ((w >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-#endif
-    }
-}
-
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
 
 void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
@@ -409,12 +394,26 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
     }
 }
 
-void ws2812_flush(void) {
-    for (int i = 0; i < WS2812_LED_COUNT; i++) {
-#if defined(WS2812_RGBW)
-        ws2812_write_led_rgbw(i, ws2812_leds[i].r, ws2812_leds[i].g, ws2812_leds[i].b, ws2812_leds[i].w);
-#else
-        ws2812_write_led(i, ws2812_leds[i].r, ws2812_leds[i].g, ws2812_leds[i].b);
+void ws2812_write_led_rgbw(uint16_t led_number, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+    ws2812_led_t led = {.r = r, .g = g, .b = b};
+#ifdef WS2812_RGBW
+    led.w = w;
 #endif
+    // Keep the record of what is in the frame buffer up to date, so that ws2812_flush() does not skip this LED
+    if (ws2812_led_changed(&ws2812_encoded_leds[led_number], &led)) {
+        ws2812_pwm_encode_led(&ws2812_frame_buffer[WS2812_COLOR_BITS * led_number], &led, ws2812_duty_cycles);
     }
 }
+
+void ws2812_write_led(uint16_t led_number, uint8_t r, uint8_t g, uint8_t b) {
+#ifdef WS2812_RGBW
+    ws2812_write_led_rgbw(led_number, r, g, b, ws2812_encoded_leds[led_number].w);
+#else
+    ws2812_write_led_rgbw(led_number, r, g, b, 0);
+#endif
+}
+
+void ws2812_flush(void) {
+    // The frame buffer starts out with every LED off, only changed LEDs need to be written
+    ws2812_pwm_encode_changed(ws2812_frame_buffer, ws2812_encoded_leds, ws2812_leds, WS2812_LED_COUNT, ws2812_duty_cycles);
+}
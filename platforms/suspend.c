@@ -41,9 +41,11 @@ __attribute__((weak)) void suspend_wakeup_init_kb(void) {
  * FIXME: needs doc
  */
 bool suspend_wakeup_condition(void) {
+#if !(defined(MATRIX_EVENT_QUEUE_THREAD) && defined(PROTOCOL_CHIBIOS))
     matrix_power_up();
     matrix_scan();
     matrix_power_down();
+#endif
     for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
         if (matrix_get_row(r)) return true;
     }
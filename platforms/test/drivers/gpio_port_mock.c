@@ -0,0 +1,18 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "gpio.h"
+
+gpio_port_value_t gpio_mock_ports[GPIO_MOCK_PORT_COUNT];
+uint16_t          gpio_mock_read_count = 0;
+
+gpio_port_value_t gpio_mock_read_port(gpio_port_t port) {
+    gpio_mock_read_count++;
+    return port < GPIO_MOCK_PORT_COUNT ? gpio_mock_ports[port] : 0;
+}
+
+void gpio_mock_reset(void) {
+    memset(gpio_mock_ports, 0xFF, sizeof(gpio_mock_ports));
+    gpio_mock_read_count = 0;
+}
@@ -0,0 +1,50 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Host-side mock of the port level GPIO API, with 32 pads per port like RP2040 and STM32.
+
+#ifndef GPIO_MOCK_PORT_COUNT
+#    define GPIO_MOCK_PORT_COUNT 4
+#endif
+
+typedef uint8_t  pin_t;
+typedef uint8_t  gpio_port_t;
+typedef uint32_t gpio_port_value_t;
+
+#define GPIO_MOCK_PIN(port, pad) ((pin_t)(((port) << 5) | (pad)))
+
+#define gpio_pin_port(pin) ((pin) >> 5)
+#define gpio_pin_pad(pin) ((pin)&0x1F)
+
+#define gpio_read_port(port) gpio_mock_read_port(port)
+#define gpio_read_pin(pin) ((gpio_mock_read_port(gpio_pin_port(pin)) >> gpio_pin_pad(pin)) & 1)
+
+/**
+ * \brief The input registers of the mocked ports, written by the tests.
+ */
+extern gpio_port_value_t gpio_mock_ports[GPIO_MOCK_PORT_COUNT];
+
+/**
+ * \brief The number of port register reads since the last reset.
+ */
+extern uint16_t gpio_mock_read_count;
+
+gpio_port_value_t gpio_mock_read_port(gpio_port_t port);
+
+/**
+ * \brief Set all pads of all ports high (released, with pull-ups) and clear the read count.
+ */
+void gpio_mock_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,169 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Host-side mock of the I2C master driver. Transactions are recorded in bus
+// order instead of being transmitted; queued asynchronous transactions only
+// reach the "bus" once i2c_async_task() or a synchronous call drains them.
+
+#include <string.h>
+#include "i2c_master.h"
+#include "i2c_master_mock.h"
+
+static i2c_mock_transaction_t i2c_mock_log[I2C_MOCK_LOG_SIZE];
+static uint16_t               i2c_mock_log_count = 0;
+static i2c_status_t           i2c_mock_status    = I2C_STATUS_SUCCESS;
+
+static i2c_status_t i2c_mock_record(uint8_t address, bool async, const uint8_t *prefix, uint16_t prefix_length, const uint8_t *data, uint16_t length) {
+    if (i2c_mock_log_count < I2C_MOCK_LOG_SIZE && prefix_length + length <= I2C_MOCK_MAX_LENGTH) {
+        i2c_mock_transaction_t *transaction = &i2c_mock_log[i2c_mock_log_count++];
+        transaction->address                = address;
+        transaction->async                  = async;
+        transaction->length                 = prefix_length + length;
+        if (prefix_length) {
+            memcpy(transaction->data, prefix, prefix_length);
+        }
+        if (length) {
+            memcpy(transaction->data + prefix_length, data, length);
+        }
+    }
+    return i2c_mock_status;
+}
+
+#ifdef I2C_ASYNC_ENABLE
+typedef struct {
+    i2c_async_callback_t callback;
+    void                *arg;
+    uint8_t              address;
+    uint16_t             length;
+    uint8_t              data[I2C_ASYNC_MAX_LENGTH];
+} i2c_async_transaction_t;
+
+static i2c_async_transaction_t i2c_async_queue[I2C_ASYNC_QUEUE_SIZE];
+static uint8_t                 i2c_async_count = 0;
+
+static i2c_status_t i2c_async_enqueue(uint8_t address, const uint8_t *prefix, uint16_t prefix_length, const uint8_t *data, uint16_t length, i2c_async_callback_t callback, void *arg) {
+    if (prefix_length + length > I2C_ASYNC_MAX_LENGTH) {
+        return I2C_STATUS_ERROR;
+    }
+
+    // Queue full, behave as though the oldest transactions have completed.
+    if (i2c_async_count == I2C_ASYNC_QUEUE_SIZE) {
+        i2c_async_wait();
+    }
+
+    i2c_async_transaction_t *transaction = &i2c_async_queue[i2c_async_count++];
+    transaction->callback                = callback;
+    transaction->arg                     = arg;
+    transaction->address                 = address;
+    transaction->length                  = prefix_length + length;
+    if (prefix_length) {
+        memcpy(transaction->data, prefix, prefix_length);
+    }
+    memcpy(transaction->data + prefix_length, data, length);
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_transmit_async(uint8_t address, const uint8_t *data, uint16_t length, i2c_async_callback_t callback, void *arg) {
+    return i2c_async_enqueue(address, NULL, 0, data, length, callback, arg);
+}
+
+i2c_status_t i2c_write_register_async(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, i2c_async_callback_t callback, void *arg) {
+    return i2c_async_enqueue(devaddr, &regaddr, 1, data, length, callback, arg);
+}
+
+bool i2c_async_busy(void) {
+    return i2c_async_count > 0;
+}
+
+void i2c_async_wait(void) {
+    // Callbacks may queue further transactions, which are drained in the same pass.
+    while (i2c_async_count > 0) {
+        i2c_async_transaction_t transaction = i2c_async_queue[0];
+        memmove(&i2c_async_queue[0], &i2c_async_queue[1], (i2c_async_count - 1) * sizeof(i2c_async_transaction_t));
+        i2c_async_count--;
+
+        i2c_status_t status = i2c_mock_record(transaction.address, true, NULL, 0, transaction.data, transaction.length);
+        if (transaction.callback) {
+            transaction.callback(status, transaction.arg);
+        }
+    }
+}
+
+void i2c_async_task(void) {
+    i2c_async_wait();
+}
+
+#    define I2C_ASYNC_BARRIER() i2c_async_wait()
+#else
+#    define I2C_ASYNC_BARRIER()
+#endif
+
+void i2c_mock_reset(void) {
+    i2c_mock_log_count = 0;
+    i2c_mock_status    = I2C_STATUS_SUCCESS;
+#ifdef I2C_ASYNC_ENABLE
+    i2c_async_count = 0;
+#endif
+}
+
+void i2c_mock_set_status(i2c_status_t status) {
+    i2c_mock_status = status;
+}
+
+uint16_t i2c_mock_transaction_count(void) {
+    return i2c_mock_log_count;
+}
+
+uint16_t i2c_mock_pending_count(void) {
+#ifdef I2C_ASYNC_ENABLE
+    return i2c_async_count;
+#else
+    return 0;
+#endif
+}
+
+const i2c_mock_transaction_t *i2c_mock_transaction(uint16_t index) {
+    return index < i2c_mock_log_count ? &i2c_mock_log[index] : NULL;
+}
+
+__attribute__((weak)) void i2c_init(void) {}
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    I2C_ASYNC_BARRIER();
+    return i2c_mock_record(address, false, NULL, 0, data, length);
+}
+
+i2c_status_t i2c_receive(uint8_t address, uint8_t *data, uint16_t length, uint16_t timeout) {
+    I2C_ASYNC_BARRIER();
+    memset(data, 0, length);
+    return i2c_mock_record(address, false, NULL, 0, NULL, 0);
+}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    I2C_ASYNC_BARRIER();
+    return i2c_mock_record(devaddr, false, &regaddr, 1, data, length);
+}
+
+i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    I2C_ASYNC_BARRIER();
+    uint8_t register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
+    return i2c_mock_record(devaddr, false, register_packet, 2, data, length);
+}
+
+i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t *data, uint16_t length, uint16_t timeout) {
+    I2C_ASYNC_BARRIER();
+    memset(data, 0, length);
+    return i2c_mock_record(devaddr, false, &regaddr, 1, NULL, 0);
+}
+
+i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t *data, uint16_t length, uint16_t timeout) {
+    I2C_ASYNC_BARRIER();
+    uint8_t register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
+    memset(data, 0, length);
+    return i2c_mock_record(devaddr, false, register_packet, 2, NULL, 0);
+}
+
+__attribute__((weak)) i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout) {
+    uint8_t data = 0;
+    return i2c_read_register(address, 0, &data, sizeof(data), timeout);
+}
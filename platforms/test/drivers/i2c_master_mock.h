@@ -0,0 +1,48 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "i2c_master.h"
+
+#ifndef I2C_MOCK_LOG_SIZE
+#    define I2C_MOCK_LOG_SIZE 128
+#endif
+
+#ifndef I2C_MOCK_MAX_LENGTH
+#    define I2C_MOCK_MAX_LENGTH 256
+#endif
+
+typedef struct {
+    uint8_t  address;
+    bool     async;
+    uint16_t length;
+    uint8_t  data[I2C_MOCK_MAX_LENGTH];
+} i2c_mock_transaction_t;
+
+/**
+ * \brief Clear the transaction log and drop any queued asynchronous transactions without completing them.
+ */
+void i2c_mock_reset(void);
+
+/**
+ * \brief Set the status returned by all subsequent transactions.
+ */
+void i2c_mock_set_status(i2c_status_t status);
+
+/**
+ * \brief The number of transactions that have been put on the bus since the last reset.
+ */
+uint16_t i2c_mock_transaction_count(void);
+
+/**
+ * \brief The number of asynchronous transactions queued but not yet put on the bus.
+ */
+uint16_t i2c_mock_pending_count(void);
+
+/**
+ * \brief Access a transaction put on the bus since the last reset, in bus order.
+ */
+const i2c_mock_transaction_t *i2c_mock_transaction(uint16_t index);
@@ -0,0 +1,141 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "i2c_master.h"
+#include "i2c_master_mock.h"
+#include "is31fl3741.h"
+
+const is31fl3741_led_t PROGMEM g_is31fl3741_leds[IS31FL3741_LED_COUNT] = {
+    {0, 0x000, 0x001, 0x002},
+    {0, 0x100, 0x101, 0x102},
+};
+}
+
+class I2cMasterAsync : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        i2c_mock_reset();
+    }
+};
+
+static uint8_t callback_count  = 0;
+static int16_t callback_status = 0;
+
+static void record_callback(i2c_status_t status, void *arg) {
+    callback_count++;
+    callback_status = status;
+    *(uint8_t *)arg = callback_count;
+}
+
+TEST_F(I2cMasterAsync, QueuedTransactionsCompleteInOrder) {
+    uint8_t first[]  = {0x01, 0x02};
+    uint8_t second[] = {0x03};
+    uint8_t order_a = 0, order_b = 0;
+    callback_count = 0;
+
+    EXPECT_EQ(i2c_write_register_async(0x30 << 1, 0x10, first, sizeof(first), record_callback, &order_a), I2C_STATUS_SUCCESS);
+    EXPECT_EQ(i2c_transmit_async(0x31 << 1, second, sizeof(second), record_callback, &order_b), I2C_STATUS_SUCCESS);
+
+    // Nothing reaches the bus until the queue is serviced.
+    EXPECT_TRUE(i2c_async_busy());
+    EXPECT_EQ(i2c_mock_transaction_count(), 0);
+    EXPECT_EQ(callback_count, 0);
+
+    i2c_async_task();
+
+    EXPECT_FALSE(i2c_async_busy());
+    ASSERT_EQ(i2c_mock_transaction_count(), 2);
+    EXPECT_EQ(i2c_mock_transaction(0)->address, 0x30 << 1);
+    EXPECT_EQ(i2c_mock_transaction(0)->length, 3);
+    EXPECT_EQ(i2c_mock_transaction(0)->data[0], 0x10);
+    EXPECT_EQ(i2c_mock_transaction(0)->data[2], 0x02);
+    EXPECT_EQ(i2c_mock_transaction(1)->address, 0x31 << 1);
+    EXPECT_EQ(order_a, 1);
+    EXPECT_EQ(order_b, 2);
+    EXPECT_EQ(callback_status, I2C_STATUS_SUCCESS);
+}
+
+TEST_F(I2cMasterAsync, DataIsCopiedOnEnqueue) {
+    uint8_t data = 0xAA;
+    i2c_transmit_async(0x30 << 1, &data, 1, NULL, NULL);
+    data = 0x55;
+    i2c_async_task();
+
+    ASSERT_EQ(i2c_mock_transaction_count(), 1);
+    EXPECT_EQ(i2c_mock_transaction(0)->data[0], 0xAA);
+}
+
+TEST_F(I2cMasterAsync, OversizedTransactionIsRejected) {
+    uint8_t data[I2C_ASYNC_MAX_LENGTH] = {0};
+    EXPECT_EQ(i2c_write_register_async(0x30 << 1, 0, data, sizeof(data), NULL, NULL), I2C_STATUS_ERROR);
+    EXPECT_FALSE(i2c_async_busy());
+}
+
+TEST_F(I2cMasterAsync, SynchronousCallsDrainTheQueueFirst) {
+    uint8_t data = 0x01;
+    i2c_transmit_async(0x30 << 1, &data, 1, NULL, NULL);
+    i2c_write_register(0x31 << 1, 0x00, &data, 1, 100);
+
+    EXPECT_FALSE(i2c_async_busy());
+    ASSERT_EQ(i2c_mock_transaction_count(), 2);
+    EXPECT_TRUE(i2c_mock_transaction(0)->async);
+    EXPECT_FALSE(i2c_mock_transaction(1)->async);
+}
+
+TEST_F(I2cMasterAsync, LedFlushReturnsBeforeTransmission) {
+    is31fl3741_set_color(0, 0x11, 0x22, 0x33);
+    is31fl3741_flush();
+
+    // 2x page select (unlock + command) plus 6 PWM0 and 9 PWM1 chunks.
+    EXPECT_EQ(i2c_mock_transaction_count(), 0);
+    EXPECT_EQ(i2c_mock_pending_count(), 2 * 2 + 6 + 9);
+
+    i2c_async_task();
+
+    ASSERT_EQ(i2c_mock_transaction_count(), 2 * 2 + 6 + 9);
+    const i2c_mock_transaction_t *pwm0 = i2c_mock_transaction(2);
+    EXPECT_EQ(pwm0->length, 31);
+    EXPECT_EQ(pwm0->data[0], 0x00);
+    EXPECT_EQ(pwm0->data[1], 0x11);
+    EXPECT_EQ(pwm0->data[2], 0x22);
+    EXPECT_EQ(pwm0->data[3], 0x33);
+
+    // Buffer is clean, nothing further to flush.
+    is31fl3741_flush();
+    EXPECT_FALSE(i2c_async_busy());
+}
+
+TEST_F(I2cMasterAsync, FailedLedFlushIsRetried) {
+    is31fl3741_set_color(1, 0x44, 0x55, 0x66);
+    is31fl3741_flush();
+    i2c_mock_set_status(I2C_STATUS_TIMEOUT);
+    i2c_async_task();
+
+    // The failed flush was put on the bus once, and left the buffer dirty.
+    EXPECT_EQ(i2c_mock_transaction_count(), 2 * 2 + 6 + 9);
+
+    i2c_mock_set_status(I2C_STATUS_SUCCESS);
+    is31fl3741_flush();
+    EXPECT_EQ(i2c_mock_pending_count(), 2 * 2 + 6 + 9);
+    i2c_async_task();
+
+    // The retry transmitted the same PWM data again.
+    ASSERT_EQ(i2c_mock_transaction_count(), 2 * (2 * 2 + 6 + 9));
+    bool color_resent = false;
+    for (uint16_t i = 2 * 2 + 6 + 9; i < i2c_mock_transaction_count(); i++) {
+        const i2c_mock_transaction_t *transaction = i2c_mock_transaction(i);
+        for (uint16_t j = 1; j + 2 < transaction->length; j++) {
+            if (transaction->data[j] == 0x44 && transaction->data[j + 1] == 0x55 && transaction->data[j + 2] == 0x66) {
+                color_resent = true;
+            }
+        }
+    }
+    EXPECT_TRUE(color_resent);
+
+    // Nothing left to retry once it succeeded.
+    is31fl3741_flush();
+    EXPECT_FALSE(i2c_async_busy());
+}
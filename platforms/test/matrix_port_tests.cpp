@@ -0,0 +1,120 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix_port.h"
+}
+
+#define P(port, pad) GPIO_MOCK_PIN(port, pad)
+
+class MatrixPort : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        gpio_mock_reset();
+    }
+
+    // reference: pins read one by one, like matrix.c does without the port map
+    static uint32_t read_pins(const pin_t *pins, uint8_t count) {
+        uint32_t pressed = 0;
+        for (uint8_t i = 0; i < count; i++) {
+            if (pins[i] != NO_PIN && gpio_read_pin(pins[i]) == MATRIX_INPUT_PRESSED_STATE) {
+                pressed |= (uint32_t)1 << i;
+            }
+        }
+        return pressed;
+    }
+
+    static void press(pin_t pin) {
+        gpio_mock_ports[gpio_pin_port(pin)] &= ~((gpio_port_value_t)1 << gpio_pin_pad(pin));
+    }
+};
+
+TEST_F(MatrixPort, ContiguousPinsFormOneSegment) {
+    const pin_t       pins[] = {P(1, 8), P(1, 9), P(1, 10), P(1, 11), P(1, 12), P(1, 13)};
+    matrix_port_map_t map;
+
+    EXPECT_TRUE(matrix_port_map_init(&map, pins, 6));
+    EXPECT_EQ(map.port_count, 1);
+    EXPECT_EQ(map.segment_count, 1);
+    EXPECT_EQ(map.segments[0].mask, 0x3F00u);
+    EXPECT_EQ(map.segments[0].shift, -8);
+
+    press(P(1, 9));
+    press(P(1, 13));
+    press(P(0, 9)); // same pad on another port
+    gpio_mock_read_count = 0;
+    EXPECT_EQ(matrix_port_map_read(&map), 0x22u);
+    EXPECT_EQ(gpio_mock_read_count, 1);
+}
+
+TEST_F(MatrixPort, OnePortReadPerPort) {
+    const pin_t       pins[] = {P(0, 3), P(0, 4), P(2, 0), P(2, 1), P(0, 5), P(2, 7), P(0, 0)};
+    matrix_port_map_t map;
+
+    EXPECT_TRUE(matrix_port_map_init(&map, pins, 7));
+    EXPECT_EQ(map.port_count, 2);
+
+    for (uint8_t i = 0; i < 7; i++) {
+        gpio_mock_reset();
+        press(pins[i]);
+        EXPECT_EQ(matrix_port_map_read(&map), 1u << i);
+        EXPECT_EQ(gpio_mock_read_count, 2);
+    }
+}
+
+TEST_F(MatrixPort, MatchesPinByPinRead) {
+    const pin_t       pins[] = {P(3, 31), P(0, 0), NO_PIN, P(0, 1), P(3, 2), P(0, 2), P(3, 3), NO_PIN, P(1, 20), P(1, 21)};
+    matrix_port_map_t map;
+
+    EXPECT_TRUE(matrix_port_map_init(&map, pins, 10));
+
+    uint32_t seed = 1;
+    for (uint16_t round = 0; round < 256; round++) {
+        for (uint8_t port = 0; port < GPIO_MOCK_PORT_COUNT; port++) {
+            seed                  = seed * 1103515245 + 12345;
+            gpio_mock_ports[port] = seed;
+        }
+        EXPECT_EQ(matrix_port_map_read(&map), read_pins(pins, 10));
+    }
+}
+
+TEST_F(MatrixPort, NoPinIsNeverPressed) {
+    const pin_t       pins[] = {NO_PIN, P(0, 1), NO_PIN};
+    matrix_port_map_t map;
+
+    EXPECT_TRUE(matrix_port_map_init(&map, pins, 3));
+    EXPECT_EQ(map.segment_count, 1);
+
+    memset(gpio_mock_ports, 0, sizeof(gpio_mock_ports));
+    EXPECT_EQ(matrix_port_map_read(&map), 0x2u);
+}
+
+TEST_F(MatrixPort, TooManySegmentsFallsBack) {
+    // reversed wiring gives every pin its own shift
+    pin_t             pins[MATRIX_PORT_MAX_SEGMENTS + 1];
+    matrix_port_map_t map;
+
+    for (uint8_t i = 0; i < MATRIX_PORT_MAX_SEGMENTS + 1; i++) {
+        pins[i] = P(0, 20 - i);
+    }
+    EXPECT_FALSE(matrix_port_map_init(&map, pins, MATRIX_PORT_MAX_SEGMENTS + 1));
+    EXPECT_EQ(map.port_count, 0);
+    EXPECT_EQ(map.segment_count, 0);
+    EXPECT_EQ(matrix_port_map_read(&map), 0u);
+
+    EXPECT_TRUE(matrix_port_map_init(&map, pins, MATRIX_PORT_MAX_SEGMENTS));
+}
+
+TEST_F(MatrixPort, TooManyPortsFallsBack) {
+    pin_t             pins[MATRIX_PORT_MAX_PORTS + 1];
+    matrix_port_map_t map;
+
+    for (uint8_t i = 0; i < MATRIX_PORT_MAX_PORTS + 1; i++) {
+        pins[i] = P(i, i);
+    }
+    EXPECT_FALSE(matrix_port_map_init(&map, pins, MATRIX_PORT_MAX_PORTS + 1));
+    EXPECT_TRUE(matrix_port_map_init(&map, pins, MATRIX_PORT_MAX_PORTS));
+}
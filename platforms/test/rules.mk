@@ -23,3 +23,48 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+i2c_master_async_DEFS := -DI2C_ASYNC_ENABLE -DIS31FL3741_I2C_ADDRESS_1=IS31FL3741_I2C_ADDRESS_GND -DIS31FL3741_LED_COUNT=2
+
+i2c_master_async_INC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers \
+	$(DRIVER_PATH)/led/issi
+
+i2c_master_async_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/i2c_master_async_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/i2c_master.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(DRIVER_PATH)/led/issi/is31fl3741.c
+
+matrix_port_DEFS := -DMATRIX_PORT_READ
+matrix_port_CONFIG := $(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/gpio_port_mock.h
+
+matrix_port_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_port_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/gpio_port_mock.c \
+	$(QUANTUM_PATH)/matrix_port.c
+
+ws2812_encode_DEFS := -DWS2812_SPI
+
+ws2812_encode_INC := $(DRIVER_PATH)/led
+
+ws2812_encode_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/ws2812_encode_tests.cpp \
+	$(DRIVER_PATH)/led/ws2812.c
+
+ws2812_encode_rgbw_DEFS := $(ws2812_encode_DEFS) -DWS2812_RGBW -DWS2812_BYTE_ORDER=WS2812_BYTE_ORDER_BGR
+ws2812_encode_rgbw_INC := $(ws2812_encode_INC)
+ws2812_encode_rgbw_SRC := $(ws2812_encode_SRC)
+
+ws2812_pwm_encode_DEFS := -DWS2812_PWM_TEST_BUFFER_T=uint8_t
+
+ws2812_pwm_encode_INC := $(DRIVER_PATH)/led
+
+ws2812_pwm_encode_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/ws2812_pwm_encode_tests.cpp \
+	$(DRIVER_PATH)/led/ws2812.c
+
+ws2812_pwm_encode_rgbw_DEFS := -DWS2812_PWM_TEST_BUFFER_T=uint32_t -DWS2812_RGBW -DWS2812_BYTE_ORDER=WS2812_BYTE_ORDER_BGR
+ws2812_pwm_encode_rgbw_INC := $(ws2812_pwm_encode_INC)
+ws2812_pwm_encode_rgbw_SRC := $(ws2812_pwm_encode_SRC)
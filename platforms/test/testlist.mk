@@ -1 +1 @@
-TEST_LIST += eeprom_legacy_emulated_flash_tiny eeprom_legacy_emulated_flash_large
+TEST_LIST += eeprom_legacy_emulated_flash_tiny eeprom_legacy_emulated_flash_large i2c_master_async matrix_port ws2812_encode ws2812_encode_rgbw ws2812_pwm_encode ws2812_pwm_encode_rgbw
@@ -0,0 +1,105 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "ws2812.h"
+}
+
+#define LED_COUNT 8
+
+// reference: the per bit pair encoding the SPI driver used before the lookup table
+static uint8_t get_protocol_eq(uint8_t data, int pos) {
+    uint8_t eq = 0;
+    if (data & (1 << (2 * (3 - pos))))
+        eq = 0b1110;
+    else
+        eq = 0b1000;
+    if (data & (2 << (2 * (3 - pos))))
+        eq += 0b11100000;
+    else
+        eq += 0b10000000;
+    return eq;
+}
+
+static void reference_encode_led(uint8_t *dst, ws2812_led_t color) {
+    const uint8_t channels[] = {
+#if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
+        color.g, color.r, color.b,
+#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
+        color.r, color.g, color.b,
+#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
+        color.b, color.g, color.r,
+#endif
+#ifdef WS2812_RGBW
+        color.w,
+#endif
+    };
+    for (uint8_t c = 0; c < sizeof(channels); c++) {
+        for (int j = 0; j < 4; j++) {
+            *dst++ = get_protocol_eq(channels[c], j);
+        }
+    }
+}
+
+static ws2812_led_t led(uint8_t r, uint8_t g, uint8_t b, uint8_t w = 0) {
+    ws2812_led_t led = {};
+    led.r            = r;
+    led.g            = g;
+    led.b            = b;
+#ifdef WS2812_RGBW
+    led.w = w;
+#endif
+    return led;
+}
+
+TEST(Ws2812Encode, EveryByteMatchesReference) {
+    uint8_t expected[4 * sizeof(ws2812_led_t)];
+    uint8_t actual[4 * sizeof(ws2812_led_t)];
+
+    for (uint16_t value = 0; value < 256; value++) {
+        // a different value on every channel to catch mixed up channels
+        ws2812_led_t color = led(value, value ^ 0x5A, 255 - value, value >> 1);
+
+        reference_encode_led(expected, color);
+        ws2812_spi_encode_led(actual, &color);
+        ASSERT_EQ(memcmp(expected, actual, sizeof(expected)), 0) << "value " << value;
+    }
+}
+
+TEST(Ws2812Encode, OnlyChangedLedsAreEncoded) {
+    uint8_t      buffer[LED_COUNT * 4 * sizeof(ws2812_led_t)];
+    uint8_t      expected[LED_COUNT * 4 * sizeof(ws2812_led_t)];
+    ws2812_led_t encoded[LED_COUNT] = {};
+    ws2812_led_t leds[LED_COUNT]    = {};
+
+    for (uint8_t i = 0; i < LED_COUNT; i++) {
+        ws2812_spi_encode_led(&buffer[i * 4 * sizeof(ws2812_led_t)], &encoded[i]);
+    }
+    EXPECT_EQ(ws2812_spi_encode_changed(buffer, encoded, leds, LED_COUNT), 0);
+
+    leds[2] = led(1, 2, 3, 4);
+    leds[7] = led(255, 0, 128, 7);
+    EXPECT_EQ(ws2812_spi_encode_changed(buffer, encoded, leds, LED_COUNT), 2);
+    EXPECT_EQ(memcmp(encoded, leds, sizeof(leds)), 0);
+
+    for (uint8_t i = 0; i < LED_COUNT; i++) {
+        reference_encode_led(&expected[i * 4 * sizeof(ws2812_led_t)], leds[i]);
+    }
+    EXPECT_EQ(memcmp(expected, buffer, sizeof(buffer)), 0);
+
+    EXPECT_EQ(ws2812_spi_encode_changed(buffer, encoded, leds, LED_COUNT), 0);
+}
+
+TEST(Ws2812Encode, LedChanged) {
+    ws2812_led_t encoded = led(10, 20, 30);
+    ws2812_led_t color   = led(10, 20, 30);
+
+    EXPECT_FALSE(ws2812_led_changed(&encoded, &color));
+    color.b = 31;
+    EXPECT_TRUE(ws2812_led_changed(&encoded, &color));
+    EXPECT_EQ(encoded.b, 31);
+    EXPECT_FALSE(ws2812_led_changed(&encoded, &color));
+}
@@ -0,0 +1,116 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "gtest/gtest.h"
+
+// the frame buffer width the PWM driver picks for the MCU and timer
+typedef WS2812_PWM_TEST_BUFFER_T ws2812_buffer_t;
+
+extern "C" {
+#include "ws2812_pwm_encode.h"
+}
+
+#define LED_COUNT 8
+#define LED_BITS (8 * sizeof(ws2812_led_t))
+
+// distinct from each other and from zero in every buffer width
+static const ws2812_buffer_t duty_cycles[2] = {(ws2812_buffer_t)0x5A5A5A5A, (ws2812_buffer_t)0xA5A5A5A5};
+
+// reference: one duty cycle per bit of each channel in wire order, MSB first
+static void reference_encode_led(ws2812_buffer_t *dst, ws2812_led_t color) {
+    const uint8_t channels[] = {
+#if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
+        color.g, color.r, color.b,
+#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
+        color.r, color.g, color.b,
+#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
+        color.b, color.g, color.r,
+#endif
+#ifdef WS2812_RGBW
+        color.w,
+#endif
+    };
+    for (uint8_t c = 0; c < sizeof(channels); c++) {
+        for (uint8_t mask = 0x80; mask; mask >>= 1) {
+            *dst++ = (channels[c] & mask) ? duty_cycles[1] : duty_cycles[0];
+        }
+    }
+}
+
+static ws2812_led_t led(uint8_t r, uint8_t g, uint8_t b, uint8_t w = 0) {
+    ws2812_led_t led = {};
+    led.r            = r;
+    led.g            = g;
+    led.b            = b;
+#ifdef WS2812_RGBW
+    led.w = w;
+#endif
+    return led;
+}
+
+TEST(Ws2812PwmEncode, EveryByteMatchesReference) {
+    ws2812_buffer_t expected[LED_BITS];
+    ws2812_buffer_t actual[LED_BITS];
+
+    for (uint16_t value = 0; value < 256; value++) {
+        // a different value on every channel to catch mixed up channels
+        ws2812_led_t color = led(value, value ^ 0x5A, 255 - value, value >> 1);
+
+        reference_encode_led(expected, color);
+        ws2812_pwm_encode_led(actual, &color, duty_cycles);
+        ASSERT_EQ(memcmp(expected, actual, sizeof(expected)), 0) << "value " << value;
+    }
+}
+
+TEST(Ws2812PwmEncode, OnlyChangedLedsAreEncoded) {
+    ws2812_buffer_t buffer[LED_COUNT * LED_BITS];
+    ws2812_buffer_t expected[LED_COUNT * LED_BITS];
+    ws2812_led_t    encoded[LED_COUNT] = {};
+    ws2812_led_t    leds[LED_COUNT]    = {};
+
+    for (uint8_t i = 0; i < LED_COUNT; i++) {
+        ws2812_pwm_encode_led(&buffer[i * LED_BITS], &encoded[i], duty_cycles);
+    }
+    EXPECT_EQ(ws2812_pwm_encode_changed(buffer, encoded, leds, LED_COUNT, duty_cycles), 0);
+
+    leds[2] = led(1, 2, 3, 4);
+    leds[7] = led(255, 0, 128, 7);
+    EXPECT_EQ(ws2812_pwm_encode_changed(buffer, encoded, leds, LED_COUNT, duty_cycles), 2);
+    EXPECT_EQ(memcmp(encoded, leds, sizeof(leds)), 0);
+
+    for (uint8_t i = 0; i < LED_COUNT; i++) {
+        reference_encode_led(&expected[i * LED_BITS], leds[i]);
+    }
+    EXPECT_EQ(memcmp(expected, buffer, sizeof(buffer)), 0);
+
+    EXPECT_EQ(ws2812_pwm_encode_changed(buffer, encoded, leds, LED_COUNT, duty_cycles), 0);
+}
+
+// An LED written straight to the buffer, as by ws2812_write_led(), has to be re-encoded by the next flush
+TEST(Ws2812PwmEncode, DirectWriteInvalidatesFlushedLed) {
+    ws2812_buffer_t buffer[LED_COUNT * LED_BITS];
+    ws2812_buffer_t expected[LED_COUNT * LED_BITS];
+    ws2812_led_t    encoded[LED_COUNT] = {};
+    ws2812_led_t    leds[LED_COUNT]    = {};
+
+    for (uint8_t i = 0; i < LED_COUNT; i++) {
+        ws2812_pwm_encode_led(&buffer[i * LED_BITS], &encoded[i], duty_cycles);
+        leds[i] = led(i + 1, 2 * i, 3 * i, 4 * i);
+    }
+    EXPECT_EQ(ws2812_pwm_encode_changed(buffer, encoded, leds, LED_COUNT, duty_cycles), LED_COUNT);
+
+    ws2812_led_t direct = led(200, 100, 50, 25);
+    ASSERT_TRUE(ws2812_led_changed(&encoded[5], &direct));
+    ws2812_pwm_encode_led(&buffer[5 * LED_BITS], &direct, duty_cycles);
+
+    // the same colour again is not re-encoded
+    ASSERT_FALSE(ws2812_led_changed(&encoded[5], &direct));
+
+    // the flush restores the LED the direct write replaced, and only that one
+    EXPECT_EQ(ws2812_pwm_encode_changed(buffer, encoded, leds, LED_COUNT, duty_cycles), 1);
+    for (uint8_t i = 0; i < LED_COUNT; i++) {
+        reference_encode_led(&expected[i * LED_BITS], leds[i]);
+    }
+    EXPECT_EQ(memcmp(expected, buffer, sizeof(buffer)), 0);
+}
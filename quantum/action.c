@@ -130,10 +130,16 @@ void action_exec(keyevent_t event) {
         retroshift_poll_time(&event);
     }
 #    endif
+    if (IS_EVENT(record.event)) {
+        resolve_record_keycode(&record);
+    }
     if (IS_NOEVENT(record.event) || pre_process_record_quantum(&record)) {
         action_tapping_process(record);
     }
 #else
+    if (IS_EVENT(record.event)) {
+        resolve_record_keycode(&record);
+    }
     if (IS_NOEVENT(record.event) || pre_process_record_quantum(&record)) {
         process_record(&record);
     }
@@ -281,6 +287,9 @@ void process_record(keyrecord_t *record) {
     if (IS_NOEVENT(record->event)) {
         return;
     }
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_process_start(record->event);
+#endif
 #ifdef FLOW_TAP_TERM
     flow_tap_update_last_event(record);
 #endif // FLOW_TAP_TERM
@@ -290,12 +299,18 @@ void process_record(keyrecord_t *record) {
         if (is_oneshot_layer_active() && record->event.pressed && keymap_config.oneshot_enable) {
             clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
         }
+#endif
+#ifdef LATENCY_TRACE_ENABLE
+        latency_trace_process_end(record->event);
 #endif
         return;
     }
 
     process_record_handler(record);
     post_process_record_quantum(record);
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_process_end(record->event);
+#endif
 }
 
 void process_record_handler(keyrecord_t *record) {
@@ -901,6 +916,7 @@ void process_action(keyrecord_t *record, action_t action) {
      */
     if (do_release_oneshot && !(get_oneshot_layer_state() & ONESHOT_PRESSED)) {
         record->event.pressed = false;
+        clear_record_keycode(record);
         layer_on(get_oneshot_layer());
         process_record(record);
         layer_off(get_oneshot_layer());
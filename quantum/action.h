@@ -53,8 +53,15 @@ typedef struct keyrecord_t {
 #if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
     uint16_t keycode;
 #endif
+    uint16_t resolved_keycode; // memoised result of get_record_keycode()
+    bool     keycode_resolved;
 } keyrecord_t;
 
+/* Resolve and memoise the keycode of the record, see get_record_keycode() */
+uint16_t resolve_record_keycode(keyrecord_t *record);
+/* Forget the memoised keycode of the record, see get_record_keycode() */
+void clear_record_keycode(keyrecord_t *record);
+
 /* Execute action per keyevent */
 void action_exec(keyevent_t event);
 
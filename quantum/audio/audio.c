@@ -413,8 +413,12 @@ float audio_get_frequency(uint8_t tone_index) {
 }
 
 float audio_get_processed_frequency(uint8_t tone_index) {
+    return (float)audio_get_processed_frequency_fixed(tone_index) / (1UL << VOICE_FREQUENCY_SHIFT);
+}
+
+uint32_t audio_get_processed_frequency_fixed(uint8_t tone_index) {
     if (tone_index >= active_tones) {
-        return 0.0f;
+        return 0;
     }
 
     int8_t index = active_tones - tone_index - 1;
@@ -427,10 +431,10 @@ float audio_get_processed_frequency(uint8_t tone_index) {
 #endif
 
     if (tones[index].pitch <= 0.0f) {
-        return 0.0f;
+        return 0;
     }
 
-    return voice_envelope(tones[index].pitch);
+    return voice_envelope_fixed(VOICE_FREQUENCY_FIXED(tones[index].pitch));
 }
 
 bool audio_update_state(void) {
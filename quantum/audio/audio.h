@@ -251,6 +251,13 @@ float audio_get_frequency(uint8_t tone_index);
  */
 float audio_get_processed_frequency(uint8_t tone_index);
 
+/**
+ * @brief same as audio_get_processed_frequency, but without any float math
+ * @return a positive frequency, in units of 2^-VOICE_FREQUENCY_SHIFT Hz; or
+ *         zero if the tone is a pause
+ */
+uint32_t audio_get_processed_frequency_fixed(uint8_t tone_index);
+
 /**
  * @brief   update audio internal state: currently playing and active tones,...
  * @details This function is intended to be called by the audio-hardware
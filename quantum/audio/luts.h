@@ -21,7 +21,12 @@
 
 #define VIBRATO_LUT_LENGTH 20
 
+/* vibrato_offset_lut holds the same curve as vibrato_lut, as signed deviations
+ * from 1.0 in units of 2^-VIBRATO_OFFSET_LUT_SHIFT, for integer-only scaling */
+#define VIBRATO_OFFSET_LUT_SHIFT 20
+
 #define FREQUENCY_LUT_LENGTH 349
 
 extern const float    vibrato_lut[VIBRATO_LUT_LENGTH];
+extern const int16_t  vibrato_offset_lut[VIBRATO_LUT_LENGTH];
 extern const uint16_t frequency_lut[FREQUENCY_LUT_LENGTH];
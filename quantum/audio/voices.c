@@ -17,8 +17,8 @@
 #include "voices.h"
 #include "audio.h"
 #include "timer.h"
+#include "util.h"
 #include <stdlib.h>
-#include <math.h>
 
 uint8_t note_timbre      = TIMBRE_DEFAULT;
 bool    glissando        = false;
@@ -26,6 +26,17 @@ bool    vibrato          = false;
 float   vibrato_strength = 0.5;
 float   vibrato_rate     = 0.125;
 
+// fixed-point mirrors of the vibrato settings, refreshed whenever those change,
+// so that voice_envelope does not need any pow/fmod on every state update
+#define VIBRATO_STRENGTH_SHIFT 8
+#define VIBRATO_STEP_SHIFT 16
+// one lut entry per millisecond, below this rate timer_read() * step would overflow in voice_add_vibrato
+#define VIBRATO_RATE_MIN 0.01f
+// two semitones, which keeps the scaled offset within 13 bits for voice_add_offset
+#define VIBRATO_STRENGTH_MAX 16.0f
+static uint16_t vibrato_strength_fixed = (uint16_t)(0.5 * (1 << VIBRATO_STRENGTH_SHIFT));
+static uint32_t vibrato_step_fixed     = (uint32_t)((1 << VIBRATO_STEP_SHIFT) / (100 * 0.125) + 0.5);
+
 uint16_t voices_timer = 0;
 
 #ifdef AUDIO_VOICE_DEFAULT
@@ -46,25 +57,42 @@ void voice_deiterate(void) {
     voice = (voice - 1 + number_of_voices) % number_of_voices;
 }
 
+static void voice_update_vibrato_fixed(void) {
+    vibrato_strength_fixed = (vibrato_strength > 0) ? (uint16_t)(MIN(vibrato_strength, VIBRATO_STRENGTH_MAX) * (1 << VIBRATO_STRENGTH_SHIFT)) : 0;
+    vibrato_step_fixed     = (vibrato_rate > 0) ? (uint32_t)((1 << VIBRATO_STEP_SHIFT) / (100 * MAX(vibrato_rate, VIBRATO_RATE_MIN)) + 0.5f) : 0;
+}
+
 #ifdef AUDIO_VOICES
-float mod(float a, int b) {
-    float r = fmod(a, b);
-    return r < 0 ? r + b : r;
+// offset precision dropped so that whole Hz (16 bits) times the offset (13 bits and sign) fit in an int32
+#    define VIBRATO_OFFSET_SCALE_SHIFT 4
+
+// Scales a frequency by 1 + offset / 2^VIBRATO_OFFSET_LUT_SHIFT
+static inline uint32_t voice_add_offset(uint32_t frequency, int32_t offset) {
+    int32_t hz = MIN(frequency >> VOICE_FREQUENCY_SHIFT, UINT16_MAX);
+    return frequency + ((hz * (offset >> VIBRATO_OFFSET_SCALE_SHIFT)) >> (VIBRATO_OFFSET_LUT_SHIFT - VIBRATO_OFFSET_SCALE_SHIFT - VOICE_FREQUENCY_SHIFT));
 }
 
 // Effect: 'vibrate' a given target frequency slightly above/below its initial value
-float voice_add_vibrato(float average_freq) {
-    float vibrato_counter = mod(timer_read() / (100 * vibrato_rate), VIBRATO_LUT_LENGTH);
+uint32_t voice_add_vibrato(uint32_t average_freq) {
+    // timer_read() / (100 * vibrato_rate), wrapped to the lut
+    uint8_t vibrato_counter = (((uint32_t)timer_read() * vibrato_step_fixed) >> VIBRATO_STEP_SHIFT) % VIBRATO_LUT_LENGTH;
 
-    return average_freq * pow(vibrato_lut[(int)vibrato_counter], vibrato_strength);
+    // pow(lut, strength) is approximated by 1 + (lut - 1) * strength, which is
+    // accurate to well below a cent for the less than 1% deviation of the lut
+    int32_t offset = ((int32_t)vibrato_offset_lut[vibrato_counter] * vibrato_strength_fixed) >> VIBRATO_STRENGTH_SHIFT;
+
+    return voice_add_offset(average_freq, offset);
 }
 
+// A glissando step of f * 2^(440 / f / 24) is, to first order, f + 440 * ln(2) / 24 Hz
+#    define VOICE_GLISSANDO_STEP VOICE_FREQUENCY_FIXED(12.708)
+
 // Effect: 'slides' the 'frequency' from the starting-point, to the target frequency
-float voice_add_glissando(float from_freq, float to_freq) {
-    if (to_freq != 0 && from_freq < to_freq && from_freq < to_freq * pow(2, -440 / to_freq / 12 / 2)) {
-        return from_freq * pow(2, 440 / from_freq / 12 / 2);
-    } else if (to_freq != 0 && from_freq > to_freq && from_freq > to_freq * pow(2, 440 / to_freq / 12 / 2)) {
-        return from_freq * pow(2, -440 / from_freq / 12 / 2);
+uint32_t voice_add_glissando(uint32_t from_freq, uint32_t to_freq) {
+    if (to_freq != 0 && from_freq + VOICE_GLISSANDO_STEP < to_freq) {
+        return from_freq + VOICE_GLISSANDO_STEP;
+    } else if (to_freq != 0 && from_freq > to_freq + VOICE_GLISSANDO_STEP) {
+        return from_freq - VOICE_GLISSANDO_STEP;
     } else {
         return to_freq;
     }
@@ -72,6 +100,10 @@ float voice_add_glissando(float from_freq, float to_freq) {
 #endif
 
 float voice_envelope(float frequency) {
+    return (float)voice_envelope_fixed(VOICE_FREQUENCY_FIXED(frequency)) / (1UL << VOICE_FREQUENCY_SHIFT);
+}
+
+uint32_t voice_envelope_fixed(uint32_t frequency) {
     // envelope_index ranges from 0 to 0xFFFF, which is preserved at 880.0 Hz
 //    __attribute__((unused)) uint16_t compensated_index = (uint16_t)((float)envelope_index * (880.0 / frequency));
 #ifdef AUDIO_VOICES
@@ -128,10 +160,10 @@ float voice_envelope(float frequency) {
             // }
             // frequency = (rand() % (int)(frequency * 1.2 - frequency)) + (frequency * 0.8);
 
-            if (frequency < 80.0) {
-            } else if (frequency < 160.0) {
+            if (frequency < VOICE_FREQUENCY_FIXED(80)) {
+            } else if (frequency < VOICE_FREQUENCY_FIXED(160)) {
                 // Bass drum: 60 - 100 Hz
-                frequency = (rand() % (int)(40)) + 60;
+                frequency = VOICE_FREQUENCY_FIXED((rand() % (int)(40)) + 60);
                 switch (envelope_index) {
                     case 0 ... 10:
                         note_timbre = 50;
@@ -144,9 +176,9 @@ float voice_envelope(float frequency) {
                         break;
                 }
 
-            } else if (frequency < 320.0) {
+            } else if (frequency < VOICE_FREQUENCY_FIXED(320)) {
                 // Snare drum: 1 - 2 KHz
-                frequency = (rand() % (int)(1000)) + 1000;
+                frequency = VOICE_FREQUENCY_FIXED((rand() % (int)(1000)) + 1000);
                 switch (envelope_index) {
                     case 0 ... 5:
                         note_timbre = 50;
@@ -159,9 +191,9 @@ float voice_envelope(float frequency) {
                         break;
                 }
 
-            } else if (frequency < 640.0) {
+            } else if (frequency < VOICE_FREQUENCY_FIXED(640)) {
                 // Closed Hi-hat: 3 - 5 KHz
-                frequency = (rand() % (int)(2000)) + 3000;
+                frequency = VOICE_FREQUENCY_FIXED((rand() % (int)(2000)) + 3000);
                 switch (envelope_index) {
                     case 0 ... 15:
                         note_timbre = 50;
@@ -174,9 +206,9 @@ float voice_envelope(float frequency) {
                         break;
                 }
 
-            } else if (frequency < 1280.0) {
+            } else if (frequency < VOICE_FREQUENCY_FIXED(1280)) {
                 // Open Hi-hat: 3 - 5 KHz
-                frequency = (rand() % (int)(2000)) + 3000;
+                frequency = VOICE_FREQUENCY_FIXED((rand() % (int)(2000)) + 3000);
                 switch (envelope_index) {
                     case 0 ... 35:
                         note_timbre = 50;
@@ -204,7 +236,8 @@ float voice_envelope(float frequency) {
                     break;
 
                 case 20 ... 200:
-                    note_timbre = 12 - (uint8_t)(pow(((float)compensated_index - 20) / (200 - 20), 2) * 12.5);
+                    // 12.5 * ((compensated_index - 20) / (200 - 20))^2
+                    note_timbre = 12 - (uint8_t)((uint32_t)(compensated_index - 20) * (compensated_index - 20) * 25 / (2 * (200 - 20) * (200 - 20)));
                     break;
 
                 default:
@@ -241,18 +274,18 @@ float voice_envelope(float frequency) {
             switch (compensated_index) {
                 default:
 #    define OCS_SPEED 10
-#    define OCS_AMP .25
+#    define OCS_AMP 25 // percent
                     // sine wave is slow
-                    // note_timbre = (sin((float)compensated_index/10000*OCS_SPEED) * OCS_AMP / 2) + .5;
+                    // note_timbre = (sin((float)compensated_index/10000*OCS_SPEED) * OCS_AMP / 2) + 50;
                     // triangle wave is a bit faster
-                    note_timbre = (uint8_t)abs((compensated_index * OCS_SPEED % 3000) - 1500) * (OCS_AMP / 1500) + (1 - OCS_AMP) / 2;
+                    note_timbre = (uint8_t)(abs((compensated_index * OCS_SPEED % 3000) - 1500) * OCS_AMP / 1500 + (100 - OCS_AMP) / 2);
                     break;
             }
             break;
 
         case duty_octave_down:
             glissando   = true;
-            note_timbre = (uint8_t)(100 * (envelope_index % 2) * .125 + .375 * 2);
+            note_timbre = (uint8_t)((100 * (envelope_index % 2) * 125 + 750) / 1000);
             if ((envelope_index % 4) == 0) note_timbre = 50;
             if ((envelope_index % 8) == 0) note_timbre = 0;
             break;
@@ -266,7 +299,7 @@ float voice_envelope(float frequency) {
                     break;
                 default:
                     // TODO: merge/replace with voice_add_vibrato above
-                    frequency = frequency * vibrato_lut[(int)fmod((((float)compensated_index - (VOICE_VIBRATO_DELAY + 1)) / 1000 * VOICE_VIBRATO_SPEED), VIBRATO_LUT_LENGTH)];
+                    frequency = voice_add_offset(frequency, vibrato_offset_lut[((compensated_index - (VOICE_VIBRATO_DELAY + 1)) * VOICE_VIBRATO_SPEED / 1000) % VIBRATO_LUT_LENGTH]);
                     break;
             }
             break;
@@ -318,7 +351,7 @@ float voice_envelope(float frequency) {
     }
 
 #ifdef AUDIO_VOICES
-    if (vibrato && (vibrato_strength > 0)) {
+    if (vibrato && (vibrato_strength_fixed > 0)) {
         frequency = voice_add_vibrato(frequency);
     }
 
@@ -335,21 +368,27 @@ float voice_envelope(float frequency) {
 
 void voice_set_vibrato_rate(float rate) {
     vibrato_rate = rate;
+    voice_update_vibrato_fixed();
 }
 void voice_increase_vibrato_rate(float change) {
     vibrato_rate *= change;
+    voice_update_vibrato_fixed();
 }
 void voice_decrease_vibrato_rate(float change) {
     vibrato_rate /= change;
+    voice_update_vibrato_fixed();
 }
 void voice_set_vibrato_strength(float strength) {
     vibrato_strength = strength;
+    voice_update_vibrato_fixed();
 }
 void voice_increase_vibrato_strength(float change) {
     vibrato_strength *= change;
+    voice_update_vibrato_fixed();
 }
 void voice_decrease_vibrato_strength(float change) {
     vibrato_strength /= change;
+    voice_update_vibrato_fixed();
 }
 
 // Timbre functions
@@ -21,7 +21,12 @@
 #include "wait.h"
 #include "luts.h"
 
-float voice_envelope(float frequency);
+/* Voices process frequencies as fixed point, in units of 2^-VOICE_FREQUENCY_SHIFT Hz */
+#define VOICE_FREQUENCY_SHIFT 8
+#define VOICE_FREQUENCY_FIXED(hz) ((uint32_t)((hz) * (1UL << VOICE_FREQUENCY_SHIFT)))
+
+float    voice_envelope(float frequency);
+uint32_t voice_envelope_fixed(uint32_t frequency);
 
 typedef enum {
     default_voice,
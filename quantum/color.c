@@ -19,6 +19,46 @@
 #include "progmem.h"
 #include "util.h"
 
+#ifdef HSV_TO_RGB_LUT
+// clang-format off
+// The region and remainder of every hue, as computed by hsv_to_rgb_impl()
+static const uint8_t HSV_HUE_SECTORS[256][2] PROGMEM = {
+    {0,   0}, {0,   6}, {0,  12}, {0,  18}, {0,  24}, {0,  30}, {0,  36}, {0,  42},
+    {0,  48}, {0,  54}, {0,  60}, {0,  66}, {0,  72}, {0,  78}, {0,  84}, {0,  90},
+    {0,  96}, {0, 102}, {0, 108}, {0, 114}, {0, 120}, {0, 126}, {0, 132}, {0, 138},
+    {0, 144}, {0, 150}, {0, 156}, {0, 162}, {0, 168}, {0, 174}, {0, 180}, {0, 186},
+    {0, 192}, {0, 198}, {0, 204}, {0, 210}, {0, 216}, {0, 222}, {0, 228}, {0, 234},
+    {0, 240}, {0, 246}, {0, 252}, {1,   3}, {1,   9}, {1,  15}, {1,  21}, {1,  27},
+    {1,  33}, {1,  39}, {1,  45}, {1,  51}, {1,  57}, {1,  63}, {1,  69}, {1,  75},
+    {1,  81}, {1,  87}, {1,  93}, {1,  99}, {1, 105}, {1, 111}, {1, 117}, {1, 123},
+    {1, 129}, {1, 135}, {1, 141}, {1, 147}, {1, 153}, {1, 159}, {1, 165}, {1, 171},
+    {1, 177}, {1, 183}, {1, 189}, {1, 195}, {1, 201}, {1, 207}, {1, 213}, {1, 219},
+    {1, 225}, {1, 231}, {1, 237}, {1, 243}, {1, 249}, {2,   0}, {2,   6}, {2,  12},
+    {2,  18}, {2,  24}, {2,  30}, {2,  36}, {2,  42}, {2,  48}, {2,  54}, {2,  60},
+    {2,  66}, {2,  72}, {2,  78}, {2,  84}, {2,  90}, {2,  96}, {2, 102}, {2, 108},
+    {2, 114}, {2, 120}, {2, 126}, {2, 132}, {2, 138}, {2, 144}, {2, 150}, {2, 156},
+    {2, 162}, {2, 168}, {2, 174}, {2, 180}, {2, 186}, {2, 192}, {2, 198}, {2, 204},
+    {2, 210}, {2, 216}, {2, 222}, {2, 228}, {2, 234}, {2, 240}, {2, 246}, {2, 252},
+    {3,   3}, {3,   9}, {3,  15}, {3,  21}, {3,  27}, {3,  33}, {3,  39}, {3,  45},
+    {3,  51}, {3,  57}, {3,  63}, {3,  69}, {3,  75}, {3,  81}, {3,  87}, {3,  93},
+    {3,  99}, {3, 105}, {3, 111}, {3, 117}, {3, 123}, {3, 129}, {3, 135}, {3, 141},
+    {3, 147}, {3, 153}, {3, 159}, {3, 165}, {3, 171}, {3, 177}, {3, 183}, {3, 189},
+    {3, 195}, {3, 201}, {3, 207}, {3, 213}, {3, 219}, {3, 225}, {3, 231}, {3, 237},
+    {3, 243}, {3, 249}, {4,   0}, {4,   6}, {4,  12}, {4,  18}, {4,  24}, {4,  30},
+    {4,  36}, {4,  42}, {4,  48}, {4,  54}, {4,  60}, {4,  66}, {4,  72}, {4,  78},
+    {4,  84}, {4,  90}, {4,  96}, {4, 102}, {4, 108}, {4, 114}, {4, 120}, {4, 126},
+    {4, 132}, {4, 138}, {4, 144}, {4, 150}, {4, 156}, {4, 162}, {4, 168}, {4, 174},
+    {4, 180}, {4, 186}, {4, 192}, {4, 198}, {4, 204}, {4, 210}, {4, 216}, {4, 222},
+    {4, 228}, {4, 234}, {4, 240}, {4, 246}, {4, 252}, {5,   3}, {5,   9}, {5,  15},
+    {5,  21}, {5,  27}, {5,  33}, {5,  39}, {5,  45}, {5,  51}, {5,  57}, {5,  63},
+    {5,  69}, {5,  75}, {5,  81}, {5,  87}, {5,  93}, {5,  99}, {5, 105}, {5, 111},
+    {5, 117}, {5, 123}, {5, 129}, {5, 135}, {5, 141}, {5, 147}, {5, 153}, {5, 159},
+    {5, 165}, {5, 171}, {5, 177}, {5, 183}, {5, 189}, {5, 195}, {5, 201}, {5, 207},
+    {5, 213}, {5, 219}, {5, 225}, {5, 231}, {5, 237}, {5, 243}, {5, 249}, {6,   0}
+};
+// clang-format on
+#endif
+
 rgb_t hsv_to_rgb_impl(hsv_t hsv, bool use_cie) {
     rgb_t    rgb;
     uint8_t  region, remainder, p, q, t;
@@ -53,8 +93,13 @@ rgb_t hsv_to_rgb_impl(hsv_t hsv, bool use_cie) {
     v = hsv.v;
 #endif
 
+#ifdef HSV_TO_RGB_LUT
+    region    = pgm_read_byte(&HSV_HUE_SECTORS[h][0]);
+    remainder = pgm_read_byte(&HSV_HUE_SECTORS[h][1]);
+#else
     region    = h * 6 / 255;
     remainder = (h * 2 - region * 85) * 3;
+#endif
 
     p = (v * (255 - s)) >> 8;
     q = (v * (255 - ((s * remainder) >> 8))) >> 8;
@@ -108,3 +153,14 @@ rgb_t hsv_to_rgb(hsv_t hsv) {
 rgb_t hsv_to_rgb_nocie(hsv_t hsv) {
     return hsv_to_rgb_impl(hsv, false);
 }
+
+void hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count, rgb_t (*convert)(hsv_t hsv)) {
+    for (uint8_t i = 0; i < count; i++) {
+        // neighbouring LEDs often share a colour, e.g. in reactive effects
+        if (i > 0 && hsv[i].h == hsv[i - 1].h && hsv[i].s == hsv[i - 1].s && hsv[i].v == hsv[i - 1].v) {
+            rgb[i] = rgb[i - 1];
+        } else {
+            rgb[i] = convert(hsv[i]);
+        }
+    }
+}
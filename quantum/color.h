@@ -95,3 +95,8 @@ typedef hsv_t HSV;
 
 rgb_t hsv_to_rgb(hsv_t hsv);
 rgb_t hsv_to_rgb_nocie(hsv_t hsv);
+
+/**
+ * @brief Converts an array of colors with the given conversion function, e.g. hsv_to_rgb(). Consecutive identical colors are only converted once.
+ */
+void hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count, rgb_t (*convert)(hsv_t hsv));
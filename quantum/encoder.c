@@ -4,6 +4,7 @@
 #include <string.h>
 #include "action.h"
 #include "encoder.h"
+#include "timer.h"
 #include "wait.h"
 
 #ifndef ENCODER_MAP_KEY_DELAY
@@ -17,11 +18,57 @@ __attribute__((weak)) bool should_process_encoder(void) {
 static encoder_events_t encoder_events;
 static bool             signal_queue_drain = false;
 
+static uint32_t encoder_last_step_time[NUM_ENCODERS];
+static uint16_t encoder_velocity[NUM_ENCODERS];
+
 void encoder_init(void) {
     memset(&encoder_events, 0, sizeof(encoder_events));
+    memset(encoder_velocity, 0, sizeof(encoder_velocity));
+    for (uint8_t index = 0; index < NUM_ENCODERS; index++) {
+        encoder_last_step_time[index] = timer_read32() - ENCODER_VELOCITY_TIMEOUT - 1;
+    }
     encoder_driver_init();
 }
 
+/**
+ * @brief Updates the velocity of every encoder from the steps about to be handled,
+ * so that it is already current while they are handled.
+ */
+static void encoder_update_velocity(void) {
+    const uint32_t now                 = timer_read32();
+    uint8_t        steps[NUM_ENCODERS] = {0};
+
+    for (uint8_t i = encoder_events.tail; i != encoder_events.head; i = (i + 1) % MAX_QUEUED_ENCODER_EVENTS) {
+        if (encoder_events.queue[i].index < NUM_ENCODERS) {
+            steps[encoder_events.queue[i].index]++;
+        }
+    }
+
+    for (uint8_t index = 0; index < NUM_ENCODERS; index++) {
+        const uint32_t elapsed = TIMER_DIFF_32(now, encoder_last_step_time[index]);
+
+        if (!steps[index]) {
+            if (elapsed > ENCODER_VELOCITY_TIMEOUT) {
+                encoder_velocity[index] = 0;
+            }
+            continue;
+        }
+
+        if (elapsed > ENCODER_VELOCITY_TIMEOUT) {
+            // first steps after a pause, there is nothing to measure them against yet
+            encoder_velocity[index] = 0;
+        } else {
+            const uint16_t velocity = (uint16_t)((uint32_t)steps[index] * 1000 / MAX(elapsed, 1));
+            encoder_velocity[index] = encoder_velocity[index] ? (encoder_velocity[index] + velocity) / 2 : velocity;
+        }
+        encoder_last_step_time[index] = now;
+    }
+}
+
+uint16_t encoder_get_velocity(uint8_t index) {
+    return index < NUM_ENCODERS ? encoder_velocity[index] : 0;
+}
+
 static void encoder_queue_drain(void) {
     encoder_events.tail     = encoder_events.head;
     encoder_events.dequeued = encoder_events.enqueued;
@@ -31,6 +78,7 @@ static bool encoder_handle_queue(void) {
     bool    changed = false;
     uint8_t index;
     bool    clockwise;
+    encoder_update_velocity();
     while (encoder_dequeue_event(&index, &clockwise)) {
 #ifdef ENCODER_MAP_ENABLE
 
@@ -49,6 +49,14 @@ bool encoder_dequeue_event(uint8_t *index, bool *clockwise);
 bool encoder_update_kb(uint8_t index, bool clockwise);
 bool encoder_update_user(uint8_t index, bool clockwise);
 
+#    ifndef ENCODER_VELOCITY_TIMEOUT
+#        define ENCODER_VELOCITY_TIMEOUT 250
+#    endif
+
+// Steps per second of an encoder, averaged over its recent steps. 0 while the encoder
+// is idle, and for the first steps after it has been idle for ENCODER_VELOCITY_TIMEOUT.
+uint16_t encoder_get_velocity(uint8_t index);
+
 #    ifdef SPLIT_KEYBOARD
 
 #        if defined(ENCODER_A_PINS_RIGHT)
@@ -0,0 +1,130 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <vector>
+
+extern "C" {
+#include "encoder.h"
+#include "encoder/tests/mock.h"
+
+void encoder_quadrature_handle_read(uint8_t index, uint8_t pin_a_state, uint8_t pin_b_state);
+void advance_time(uint32_t ms);
+}
+
+struct update {
+    int8_t   index;
+    bool     clockwise;
+    uint16_t velocity;
+};
+
+std::vector<update> updates;
+
+bool encoder_update_kb(uint8_t index, bool clockwise) {
+    updates.push_back({(int8_t)index, clockwise, encoder_get_velocity(index)});
+    return true;
+}
+
+// stands in for the pin change interrupt
+void setAndInterrupt(pin_t pin, bool val) {
+    setPin(pin, val);
+    encoder_quadrature_handle_read(0, pins[0], pins[1]);
+}
+
+void stepClockwise(uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        setAndInterrupt(0, false);
+        setAndInterrupt(1, false);
+        setAndInterrupt(0, true);
+        setAndInterrupt(1, true);
+    }
+}
+
+void stepCounterClockwise(uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        setAndInterrupt(1, false);
+        setAndInterrupt(0, false);
+        setAndInterrupt(1, true);
+        setAndInterrupt(0, true);
+    }
+}
+
+class EncoderInterruptTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        updates.clear();
+        encoder_init();
+    }
+};
+
+TEST_F(EncoderInterruptTest, StepsAreHandledByTheTask) {
+    stepClockwise(2);
+    stepCounterClockwise(1);
+    EXPECT_EQ(updates.size(), 0);
+
+    EXPECT_TRUE(encoder_task());
+    ASSERT_EQ(updates.size(), 3);
+    EXPECT_TRUE(updates[0].clockwise);
+    EXPECT_TRUE(updates[1].clockwise);
+    EXPECT_FALSE(updates[2].clockwise);
+    EXPECT_FALSE(encoder_task());
+}
+
+TEST_F(EncoderInterruptTest, DirectionChangesKeepTheirOrder) {
+    std::vector<bool> expected;
+    for (uint8_t i = 0; i < 4; i++) {
+        stepClockwise(3);
+        stepCounterClockwise(2);
+        expected.insert(expected.end(), {true, true, true, false, false});
+    }
+
+    while (encoder_task()) {
+    }
+    ASSERT_EQ(updates.size(), expected.size());
+    for (size_t i = 0; i < updates.size(); i++) {
+        EXPECT_EQ(updates[i].clockwise, expected[i]) << "step " << i;
+    }
+}
+
+TEST_F(EncoderInterruptTest, StepsBeyondTheQueueArePending) {
+    stepClockwise(10);
+
+    // the event queue holds MAX_QUEUED_ENCODER_EVENTS - 1 steps
+    encoder_task();
+    EXPECT_EQ(updates.size(), MAX_QUEUED_ENCODER_EVENTS - 1);
+
+    while (encoder_task()) {
+    }
+    EXPECT_EQ(updates.size(), 10);
+    for (auto &u : updates) {
+        EXPECT_EQ(u.index, 0);
+        EXPECT_TRUE(u.clockwise);
+    }
+}
+
+TEST_F(EncoderInterruptTest, Velocity) {
+    // first step after being idle
+    stepClockwise(1);
+    encoder_task();
+    ASSERT_EQ(updates.size(), 1);
+    EXPECT_EQ(updates[0].velocity, 0);
+
+    advance_time(50);
+    stepClockwise(1);
+    encoder_task();
+    ASSERT_EQ(updates.size(), 2);
+    EXPECT_EQ(updates[1].velocity, 20);
+
+    // averaged with the previous velocity
+    advance_time(25);
+    stepClockwise(2);
+    encoder_task();
+    ASSERT_EQ(updates.size(), 4);
+    EXPECT_EQ(updates[2].velocity, 50);
+    EXPECT_EQ(updates[3].velocity, 50);
+
+    advance_time(ENCODER_VELOCITY_TIMEOUT + 1);
+    encoder_task();
+    EXPECT_EQ(encoder_get_velocity(0), 0);
+}
@@ -95,6 +95,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef HD44780_ENABLE
 #    include "hd44780.h"
 #endif
+#ifdef I2C_ASYNC_ENABLE
+#    include "i2c_master.h"
+#endif
 #ifdef OLED_ENABLE
 #    include "oled_driver.h"
 #endif
@@ -143,6 +146,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef OS_DETECTION_ENABLE
 #    include "os_detection.h"
 #endif
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+#ifdef MATRIX_EVENT_QUEUE_ENABLE
+#    include "matrix_event_queue.h"
+#endif
 #ifdef LAYER_LOCK_ENABLE
 #    include "layer_lock.h"
 #endif
@@ -542,6 +551,11 @@ void keyboard_init(void) {
     haptic_init();
 #endif
 
+#ifdef MATRIX_EVENT_QUEUE_ENABLE
+    // init last, the scan thread must not race any of the above
+    matrix_event_queue_init();
+#endif
+
 #if defined(DEBUG_MATRIX_SCAN_RATE) && defined(CONSOLE_ENABLE)
     debug_enable = true;
 #endif
@@ -576,6 +590,46 @@ static inline void generate_tick_event(void) {
     }
 }
 
+#ifdef MATRIX_EVENT_QUEUE_ENABLE
+/**
+ * @brief This task processes the key presses queued by the matrix scan stage,
+ * timestamped with the scan that saw them.
+ *
+ * @return true Matrix did change
+ * @return false Matrix didn't change
+ */
+static bool matrix_task(void) {
+    matrix_event_queue_task();
+    matrix_scan_perf_task();
+
+    const bool     process_keypress = should_process_keypress();
+    bool           matrix_changed   = false;
+    matrix_event_t event;
+
+    while (matrix_event_queue_pop(&event)) {
+        matrix_changed = true;
+
+        if (process_keypress) {
+            keyevent_t key_event = MAKE_KEYEVENT(event.row, event.col, event.pressed);
+            key_event.time       = event.time;
+#    ifdef LATENCY_TRACE_ENABLE
+            latency_trace_queued_event(key_event, event.trace_scanned, event.trace_queued);
+#    endif
+            action_exec(key_event);
+        }
+
+        switch_events(event.row, event.col, event.pressed);
+    }
+
+    if (!matrix_changed) {
+        generate_tick_event();
+    } else if (debug_config.matrix) {
+        matrix_print();
+    }
+
+    return matrix_changed;
+}
+#else
 /**
  * @brief This task scans the keyboards matrix and processes any key presses
  * that occur.
@@ -591,6 +645,9 @@ static bool matrix_task(void) {
 
     static matrix_row_t matrix_previous[MATRIX_ROWS];
 
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_scan_start();
+#endif
     matrix_scan();
     bool matrix_changed = false;
     for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_changed; row++) {
@@ -625,6 +682,9 @@ static bool matrix_task(void) {
                 const bool key_pressed = current_row & col_mask;
 
                 if (process_keypress) {
+#ifdef LATENCY_TRACE_ENABLE
+                    latency_trace_event(MAKE_KEYEVENT(row, col, key_pressed));
+#endif
                     action_exec(MAKE_KEYEVENT(row, col, key_pressed));
                 }
 
@@ -637,6 +697,7 @@ static bool matrix_task(void) {
 
     return matrix_changed;
 }
+#endif
 
 /** \brief Tasks previously located in matrix_scan_quantum
  *
@@ -742,6 +803,10 @@ void keyboard_task(void) {
     rgb_matrix_task();
 #endif
 
+#ifdef I2C_ASYNC_ENABLE
+    i2c_async_task();
+#endif
+
 #if defined(BACKLIGHT_ENABLE)
 #    if defined(BACKLIGHT_PIN) || defined(BACKLIGHT_PINS)
     backlight_task();
@@ -812,4 +877,8 @@ void keyboard_task(void) {
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
+
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_task();
+#endif
 }
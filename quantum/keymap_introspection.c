@@ -149,6 +149,32 @@ __attribute__((weak)) tap_dance_action_t* tap_dance_get(uint16_t tap_dance_idx)
 
 #endif // defined(TAP_DANCE_ENABLE)
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Leader Dictionary
+
+#if defined(LEADER_ENABLE) && defined(LEADER_DICTIONARY_ENABLE)
+
+uint16_t leader_dictionary_count_raw(void) {
+    return ARRAY_SIZE(leader_dictionary);
+}
+
+__attribute__((weak)) uint16_t leader_dictionary_count(void) {
+    return leader_dictionary_count_raw();
+}
+
+const leader_entry_t* leader_dictionary_get_raw(uint16_t leader_entry_idx) {
+    if (leader_entry_idx >= leader_dictionary_count_raw()) {
+        return NULL;
+    }
+    return &leader_dictionary[leader_entry_idx];
+}
+
+__attribute__((weak)) const leader_entry_t* leader_dictionary_get(uint16_t leader_entry_idx) {
+    return leader_dictionary_get_raw(leader_entry_idx);
+}
+
+#endif // defined(LEADER_ENABLE) && defined(LEADER_DICTIONARY_ENABLE)
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Key Overrides
 
@@ -175,6 +201,12 @@ __attribute__((weak)) const key_override_t* key_override_get(uint16_t key_overri
     return key_override_get_raw(key_override_idx);
 }
 
+static uint16_t key_override_index[ARRAY_SIZE(key_overrides)];
+
+uint16_t* key_override_index_buffer(void) {
+    return key_override_index;
+}
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
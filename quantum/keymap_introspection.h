@@ -89,6 +89,25 @@ tap_dance_action_t* tap_dance_get(uint16_t tap_dance_idx);
 
 #endif // defined(TAP_DANCE_ENABLE)
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Leader Dictionary
+
+#if defined(LEADER_ENABLE) && defined(LEADER_DICTIONARY_ENABLE)
+
+#    include "leader.h"
+
+// Get the number of leader dictionary entries defined in the user's keymap, stored in firmware rather than any other persistent storage
+uint16_t leader_dictionary_count_raw(void);
+// Get the number of leader dictionary entries defined in the user's keymap, potentially stored dynamically
+uint16_t leader_dictionary_count(void);
+
+// Get the leader dictionary entries, stored in firmware rather than any other persistent storage
+const leader_entry_t* leader_dictionary_get_raw(uint16_t leader_entry_idx);
+// Get the leader dictionary entries, potentially stored dynamically (must still be readable with pgm_read_*)
+const leader_entry_t* leader_dictionary_get(uint16_t leader_entry_idx);
+
+#endif // defined(LEADER_ENABLE) && defined(LEADER_DICTIONARY_ENABLE)
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Key Overrides
 
@@ -108,4 +127,7 @@ const key_override_t* key_override_get_raw(uint16_t key_override_idx);
 // Get the key override definitions, potentially stored dynamically
 const key_override_t* key_override_get(uint16_t key_override_idx);
 
+// Get the scratch buffer used to index the key overrides, with room for key_override_count_raw() entries
+uint16_t* key_override_index_buffer(void);
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
@@ -0,0 +1,288 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "latency_trace.h"
+#include "timer.h"
+#include "print.h"
+#include "util.h"
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#endif
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#    include <hal.h>
+#    if !defined(LATENCY_TRACE_TICKS_PER_US) && defined(STM32_SYSCLK)
+#        define LATENCY_TRACE_TICKS_PER_US (STM32_SYSCLK / 1000000)
+#    endif
+#endif
+
+#if defined(PROTOCOL_CHIBIOS) && (PORT_SUPPORTS_RT == TRUE) && defined(LATENCY_TRACE_TICKS_PER_US)
+// cycle counter (DWT on ARMv7-M)
+#    define LATENCY_TRACE_TIMESTAMP() chSysGetRealtimeCounterX()
+#    define LATENCY_TRACE_TICKS_TO_US(ticks) ((ticks) / LATENCY_TRACE_TICKS_PER_US)
+#else
+// millisecond timer
+#    define LATENCY_TRACE_TIMESTAMP() timer_read32()
+#    define LATENCY_TRACE_TICKS_TO_US(ticks) ((ticks) * 1000)
+#endif
+
+typedef enum {
+    TRACE_FREE,
+    TRACE_QUEUED,
+    TRACE_PROCESSING,
+    TRACE_REPORTED,
+} trace_state_t;
+
+typedef struct {
+    trace_state_t state;
+    keypos_t      key;
+    bool          pressed;
+    uint32_t      scanned;
+    uint32_t      queued;
+    uint32_t      processing;
+    uint32_t      reported;
+} trace_t;
+
+enum latency_trace_raw_hid_commands {
+    LATENCY_TRACE_RAW_HID_GET_SUMMARY = 0x01,
+    LATENCY_TRACE_RAW_HID_GET_BUCKETS,
+    LATENCY_TRACE_RAW_HID_GET_COUNTERS,
+    LATENCY_TRACE_RAW_HID_RESET,
+    LATENCY_TRACE_RAW_HID_UNHANDLED = 0xFF,
+};
+
+static trace_t                   traces[LATENCY_TRACE_SLOTS];
+static latency_trace_histogram_t histograms[LATENCY_TRACE_STAGE_COUNT];
+static latency_trace_counters_t  counters;
+static uint32_t                  scan_timestamp;
+
+static inline bool trace_matches(const trace_t *trace, keyevent_t event) {
+    return KEYEQ(trace->key, event.key) && trace->pressed == event.pressed;
+}
+
+static void histogram_add(latency_trace_histogram_t *histogram, uint32_t us) {
+    if (histogram->count == 0 || us < histogram->min) {
+        histogram->min = us;
+    }
+    if (us > histogram->max) {
+        histogram->max = us;
+    }
+    histogram->count++;
+    histogram->sum += us;
+
+    // bucket n holds [2^(n-1), 2^n) us
+    uint8_t bucket = 0;
+    while (us != 0 && bucket < LATENCY_TRACE_BUCKETS - 1) {
+        us >>= 1;
+        bucket++;
+    }
+    if (histogram->buckets[bucket] < UINT16_MAX) {
+        histogram->buckets[bucket]++;
+    }
+}
+
+static void trace_complete(trace_t *trace) {
+    histogram_add(&histograms[LATENCY_TRACE_STAGE_SCAN], LATENCY_TRACE_TICKS_TO_US(trace->queued - trace->scanned));
+    histogram_add(&histograms[LATENCY_TRACE_STAGE_QUEUE], LATENCY_TRACE_TICKS_TO_US(trace->processing - trace->queued));
+    histogram_add(&histograms[LATENCY_TRACE_STAGE_PROCESS], LATENCY_TRACE_TICKS_TO_US(trace->reported - trace->processing));
+    histogram_add(&histograms[LATENCY_TRACE_STAGE_TOTAL], LATENCY_TRACE_TICKS_TO_US(trace->reported - trace->scanned));
+    trace->state = TRACE_FREE;
+}
+
+void latency_trace_scan_start(void) {
+    scan_timestamp = LATENCY_TRACE_TIMESTAMP();
+}
+
+uint32_t latency_trace_timestamp(void) {
+    return LATENCY_TRACE_TIMESTAMP();
+}
+
+void latency_trace_event(keyevent_t event) {
+    latency_trace_queued_event(event, scan_timestamp, LATENCY_TRACE_TIMESTAMP());
+}
+
+void latency_trace_queued_event(keyevent_t event, uint32_t scanned, uint32_t queued) {
+    trace_t *slot = NULL;
+
+    for (uint8_t i = 0; i < LATENCY_TRACE_SLOTS; i++) {
+        if (traces[i].state == TRACE_FREE) {
+            slot = &traces[i];
+            break;
+        }
+        // fall back to evicting the oldest queued event, most likely one that was consumed without being processed
+        if (traces[i].state == TRACE_QUEUED && (slot == NULL || (int32_t)(traces[i].queued - slot->queued) < 0)) {
+            slot = &traces[i];
+        }
+    }
+
+    if (slot == NULL) {
+        counters.dropped++;
+        return;
+    }
+    if (slot->state != TRACE_FREE) {
+        counters.dropped++;
+    }
+
+    slot->state   = TRACE_QUEUED;
+    slot->key     = event.key;
+    slot->pressed = event.pressed;
+    slot->scanned = scanned;
+    slot->queued  = queued;
+}
+
+void latency_trace_process_start(keyevent_t event) {
+    for (uint8_t i = 0; i < LATENCY_TRACE_SLOTS; i++) {
+        if (traces[i].state == TRACE_QUEUED && trace_matches(&traces[i], event)) {
+            traces[i].state      = TRACE_PROCESSING;
+            traces[i].processing = LATENCY_TRACE_TIMESTAMP();
+            return;
+        }
+    }
+}
+
+void latency_trace_process_end(keyevent_t event) {
+    for (uint8_t i = 0; i < LATENCY_TRACE_SLOTS; i++) {
+        if (!trace_matches(&traces[i], event)) {
+            continue;
+        }
+        if (traces[i].state == TRACE_REPORTED) {
+            trace_complete(&traces[i]);
+            return;
+        }
+        if (traces[i].state == TRACE_PROCESSING) {
+            counters.unreported++;
+            traces[i].state = TRACE_FREE;
+            return;
+        }
+    }
+}
+
+void latency_trace_report(void) {
+    uint32_t now = LATENCY_TRACE_TIMESTAMP();
+
+    for (uint8_t i = 0; i < LATENCY_TRACE_SLOTS; i++) {
+        if (traces[i].state == TRACE_PROCESSING) {
+            traces[i].state    = TRACE_REPORTED;
+            traces[i].reported = now;
+        }
+    }
+}
+
+const latency_trace_histogram_t *latency_trace_get_histogram(latency_trace_stage_t stage) {
+    if (stage >= LATENCY_TRACE_STAGE_COUNT) {
+        return NULL;
+    }
+    return &histograms[stage];
+}
+
+latency_trace_counters_t latency_trace_get_counters(void) {
+    return counters;
+}
+
+void latency_trace_reset(void) {
+    memset(traces, 0, sizeof(traces));
+    memset(histograms, 0, sizeof(histograms));
+    memset(&counters, 0, sizeof(counters));
+}
+
+void latency_trace_print(void) {
+#ifdef CONSOLE_ENABLE
+    static const char *const stage_names[LATENCY_TRACE_STAGE_COUNT] = {"scan", "queue", "process", "total"};
+
+    for (uint8_t stage = 0; stage < LATENCY_TRACE_STAGE_COUNT; stage++) {
+        const latency_trace_histogram_t *histogram = &histograms[stage];
+        uprintf("latency %-7s: n=%lu min=%luus avg=%luus max=%luus |", stage_names[stage], histogram->count, histogram->min, histogram->count ? histogram->sum / histogram->count : 0, histogram->max);
+        for (uint8_t bucket = 0; bucket < LATENCY_TRACE_BUCKETS; bucket++) {
+            uprintf(" %u", histogram->buckets[bucket]);
+        }
+        uprintf("\n");
+    }
+    uprintf("latency dropped=%u unreported=%u\n", counters.dropped, counters.unreported);
+#endif
+}
+
+static uint8_t put_u32(uint8_t *data, uint32_t value) {
+    data[0] = value & 0xFF;
+    data[1] = (value >> 8) & 0xFF;
+    data[2] = (value >> 16) & 0xFF;
+    data[3] = (value >> 24) & 0xFF;
+    return 4;
+}
+
+static uint8_t put_u16(uint8_t *data, uint16_t value) {
+    data[0] = value & 0xFF;
+    data[1] = (value >> 8) & 0xFF;
+    return 2;
+}
+
+/*
+    Raw HID requests, all multi-byte values are little endian:
+
+        [CMD, GET_SUMMARY, stage]         -> [CMD, GET_SUMMARY, stage, count:4, min:4, max:4, sum:4]
+        [CMD, GET_BUCKETS, stage, first]  -> [CMD, GET_BUCKETS, stage, first, bucket[first]:2, bucket[first + 1]:2, ...]
+        [CMD, GET_COUNTERS]               -> [CMD, GET_COUNTERS, dropped:2, unreported:2]
+        [CMD, RESET]                      -> [CMD, RESET]
+
+    Unknown requests or stages are answered with the sub-command set to UNHANDLED.
+*/
+bool latency_trace_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 4 || data[0] != LATENCY_TRACE_RAW_HID_COMMAND) {
+        return false;
+    }
+
+    const latency_trace_histogram_t *histogram = latency_trace_get_histogram(data[2]);
+    uint8_t                          offset;
+
+    switch (data[1]) {
+        case LATENCY_TRACE_RAW_HID_GET_SUMMARY:
+            if (histogram == NULL || length < 3 + 4 * 4) {
+                data[1] = LATENCY_TRACE_RAW_HID_UNHANDLED;
+                break;
+            }
+            offset = 3;
+            offset += put_u32(&data[offset], histogram->count);
+            offset += put_u32(&data[offset], histogram->min);
+            offset += put_u32(&data[offset], histogram->max);
+            offset += put_u32(&data[offset], histogram->sum);
+            break;
+        case LATENCY_TRACE_RAW_HID_GET_BUCKETS:
+            if (histogram == NULL) {
+                data[1] = LATENCY_TRACE_RAW_HID_UNHANDLED;
+                break;
+            }
+            offset = 4;
+            for (uint8_t bucket = data[3]; bucket < LATENCY_TRACE_BUCKETS && offset + 2 <= length; bucket++) {
+                offset += put_u16(&data[offset], histogram->buckets[bucket]);
+            }
+            break;
+        case LATENCY_TRACE_RAW_HID_GET_COUNTERS:
+            offset = 2;
+            offset += put_u16(&data[offset], counters.dropped);
+            offset += put_u16(&data[offset], counters.unreported);
+            break;
+        case LATENCY_TRACE_RAW_HID_RESET:
+            latency_trace_reset();
+            break;
+        default:
+            data[1] = LATENCY_TRACE_RAW_HID_UNHANDLED;
+            break;
+    }
+
+#ifdef RAW_ENABLE
+    raw_hid_send(data, length);
+#endif
+    return true;
+}
+
+void latency_trace_task(void) {
+#if defined(LATENCY_TRACE_PRINT_INTERVAL) && defined(CONSOLE_ENABLE)
+    static uint32_t print_timer = 0;
+
+    if (timer_elapsed32(print_timer) >= LATENCY_TRACE_PRINT_INTERVAL) {
+        print_timer = timer_read32();
+        latency_trace_print();
+    }
+#endif
+}
@@ -0,0 +1,129 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "keyboard.h"
+
+/*
+    Per-stage latency tracing of key events, from the matrix scan that saw the
+    switch change to the keyboard report being handed to the host driver.
+
+        scan:    start of matrix_scan() -> key event emitted by matrix_task()
+        queue:   key event emitted      -> process_record() (tapping, combos, ...)
+        process: process_record()       -> host_keyboard_send()/host_nkro_send()
+        total:   start of matrix_scan() -> host_keyboard_send()/host_nkro_send()
+
+    Events that never reach process_record() (e.g. swallowed by a combo), or
+    whose processing does not produce a report (e.g. layer keys), are counted
+    separately and are not part of the histograms.
+*/
+
+#ifndef LATENCY_TRACE_SLOTS
+#    define LATENCY_TRACE_SLOTS 8
+#endif
+
+#ifndef LATENCY_TRACE_BUCKETS
+#    define LATENCY_TRACE_BUCKETS 16
+#endif
+
+#ifndef LATENCY_TRACE_RAW_HID_COMMAND
+#    define LATENCY_TRACE_RAW_HID_COMMAND 0x4C
+#endif
+
+typedef enum {
+    LATENCY_TRACE_STAGE_SCAN,
+    LATENCY_TRACE_STAGE_QUEUE,
+    LATENCY_TRACE_STAGE_PROCESS,
+    LATENCY_TRACE_STAGE_TOTAL,
+    LATENCY_TRACE_STAGE_COUNT,
+} latency_trace_stage_t;
+
+/**
+ * @brief Aggregated latencies of one stage, in microseconds.
+ *
+ * Bucket 0 counts latencies below 1us, bucket n counts latencies in
+ * [2^(n-1), 2^n) us, and the last bucket also collects everything above.
+ */
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint32_t sum;
+    uint16_t buckets[LATENCY_TRACE_BUCKETS];
+} latency_trace_histogram_t;
+
+typedef struct {
+    uint16_t dropped;    // events evicted before they were processed
+    uint16_t unreported; // events processed without sending a report
+} latency_trace_counters_t;
+
+/**
+ * @brief Marks the start of a matrix scan.
+ */
+void latency_trace_scan_start(void);
+
+/**
+ * @brief Starts tracing a key event emitted by the matrix scan.
+ */
+void latency_trace_event(keyevent_t event);
+
+/**
+ * @brief Returns the current trace timestamp. Safe to call from any thread.
+ */
+uint32_t latency_trace_timestamp(void);
+
+/**
+ * @brief Starts tracing a key event that was scanned and queued at the given timestamps, e.g. by a scan thread.
+ */
+void latency_trace_queued_event(keyevent_t event, uint32_t scanned, uint32_t queued);
+
+/**
+ * @brief Marks a traced key event entering process_record().
+ */
+void latency_trace_process_start(keyevent_t event);
+
+/**
+ * @brief Marks a traced key event leaving process_record(), completing its trace.
+ */
+void latency_trace_process_end(keyevent_t event);
+
+/**
+ * @brief Marks a keyboard report being handed to the host driver.
+ */
+void latency_trace_report(void);
+
+/**
+ * @brief Returns the aggregated latencies of a stage.
+ */
+const latency_trace_histogram_t *latency_trace_get_histogram(latency_trace_stage_t stage);
+
+/**
+ * @brief Returns the counters of events that did not make it into the histograms.
+ */
+latency_trace_counters_t latency_trace_get_counters(void);
+
+/**
+ * @brief Clears all histograms, counters and in-flight traces.
+ */
+void latency_trace_reset(void);
+
+/**
+ * @brief Prints a summary of all stages to the console.
+ */
+void latency_trace_print(void);
+
+/**
+ * @brief Handles latency trace requests received over raw HID.
+ *
+ * To be called from `raw_hid_receive()` (or `via_command_kb()` with VIA).
+ * Requests start with `LATENCY_TRACE_RAW_HID_COMMAND`, the response is built
+ * in place and sent with `raw_hid_send()`.
+ *
+ * @return true if the request was a latency trace request and was handled
+ */
+bool latency_trace_raw_hid_receive(uint8_t *data, uint8_t length);
+
+void latency_trace_task(void);
@@ -7,15 +7,131 @@
 
 #include <string.h>
 
+#ifdef LEADER_DICTIONARY_ENABLE
+#    include "quantum.h"
+#    include "keymap_introspection.h"
+#endif
+
 #ifndef LEADER_TIMEOUT
 #    define LEADER_TIMEOUT 300
 #endif
 
+#if LEADER_SEQUENCE_LENGTH < 5
+#    error "LEADER_SEQUENCE_LENGTH must be at least 5"
+#endif
+
 // Leader key stuff
-bool     leading              = false;
-uint16_t leader_time          = 0;
-uint16_t leader_sequence[5]   = {0, 0, 0, 0, 0};
-uint8_t  leader_sequence_size = 0;
+bool     leading                                 = false;
+uint16_t leader_time                             = 0;
+uint16_t leader_sequence[LEADER_SEQUENCE_LENGTH] = {0};
+uint8_t  leader_sequence_size                    = 0;
+
+#ifdef LEADER_DICTIONARY_ENABLE
+// Dictionary entries matching the sequence so far, [first, last)
+static uint16_t leader_match_first = 0;
+static uint16_t leader_match_last  = 0;
+// An unsorted dictionary is matched by a linear scan once the sequence ends
+static bool leader_dictionary_checked = false;
+static bool leader_dictionary_sorted  = false;
+
+static inline uint16_t leader_entry_key(uint16_t index, uint8_t depth) {
+    return pgm_read_word(&leader_dictionary_get(index)->sequence[depth]);
+}
+
+/** Narrows the matching entries down to the ones continuing with `keycode` at `depth`. */
+static void leader_dictionary_match(uint8_t depth, uint16_t keycode) {
+    if (!leader_dictionary_sorted) {
+        return;
+    }
+
+    // first entry not sorting before keycode
+    uint16_t lo = leader_match_first, hi = leader_match_last;
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        if (leader_entry_key(mid, depth) < keycode) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    leader_match_first = lo;
+
+    // first entry sorting after keycode
+    hi = leader_match_last;
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        if (leader_entry_key(mid, depth) <= keycode) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    leader_match_last = lo;
+}
+
+/** Points the first match at the entry that is exactly the sequence so far, if any. */
+static bool leader_dictionary_scan(void) {
+    for (uint16_t i = 0; i < leader_dictionary_count(); i++) {
+        uint8_t depth = 0;
+        while (depth < LEADER_SEQUENCE_LENGTH && leader_entry_key(i, depth) == leader_sequence[depth]) {
+            depth++;
+        }
+        if (depth == LEADER_SEQUENCE_LENGTH) {
+            leader_match_first = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+/** Whether the first matching entry is exactly the sequence so far. Being sorted, it is the shortest of the matches. */
+static bool leader_dictionary_has_exact_match(void) {
+    if (!leader_dictionary_sorted) {
+        return leader_dictionary_scan();
+    }
+    return leader_match_first < leader_match_last && (leader_sequence_size == LEADER_SEQUENCE_LENGTH || leader_entry_key(leader_match_first, leader_sequence_size) == 0);
+}
+
+bool leader_dictionary_is_sorted(void) {
+    for (uint16_t i = 1; i < leader_dictionary_count(); i++) {
+        uint8_t depth = 0;
+        while (depth < LEADER_SEQUENCE_LENGTH && leader_entry_key(i - 1, depth) == leader_entry_key(i, depth)) {
+            depth++;
+        }
+        // equal sequences are as bad as unsorted ones, only the first could ever be executed
+        if (depth == LEADER_SEQUENCE_LENGTH || leader_entry_key(i - 1, depth) > leader_entry_key(i, depth)) {
+            dprintf("leader: leader_dictionary[%u] does not sort after leader_dictionary[%u]\n", i, i - 1);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void leader_dictionary_execute(void) {
+    if (!leader_dictionary_has_exact_match()) {
+        return;
+    }
+
+    leader_entry_t entry;
+    memcpy_P(&entry, leader_dictionary_get(leader_match_first), sizeof(leader_entry_t));
+
+    switch (entry.type) {
+        case LEADER_ENTRY_KEYCODE:
+            tap_code16(entry.keycode);
+            break;
+#    ifdef SEND_STRING_ENABLE
+        case LEADER_ENTRY_STRING:
+            send_string(entry.string);
+            break;
+#    endif
+        case LEADER_ENTRY_ACTION:
+            if (entry.action != NULL) {
+                entry.action();
+            }
+            break;
+    }
+}
+#endif
 
 __attribute__((weak)) void leader_start_user(void) {}
 
@@ -34,10 +150,25 @@ void leader_start(void) {
     leader_time          = timer_read();
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+#ifdef LEADER_DICTIONARY_ENABLE
+    if (!leader_dictionary_checked) {
+        leader_dictionary_checked = true;
+        // the binary search would silently miss sequences of an unsorted dictionary
+        leader_dictionary_sorted = leader_dictionary_is_sorted();
+        if (!leader_dictionary_sorted) {
+            dprintf("leader: leader_dictionary is not sorted, falling back to a linear scan\n");
+        }
+    }
+    leader_match_first = 0;
+    leader_match_last  = leader_dictionary_count();
+#endif
 }
 
 void leader_end(void) {
     leading = false;
+#ifdef LEADER_DICTIONARY_ENABLE
+    leader_dictionary_execute();
+#endif
     leader_end_user();
 }
 
@@ -65,9 +196,19 @@ bool leader_sequence_add(uint16_t keycode) {
     leader_sequence[leader_sequence_size] = keycode;
     leader_sequence_size++;
 
+#ifdef LEADER_DICTIONARY_ENABLE
+    leader_dictionary_match(leader_sequence_size - 1, keycode);
+#endif
+
     if (leader_add_user(keycode)) {
         leader_end();
     }
+#ifdef LEADER_DICTIONARY_ENABLE
+    // nothing left to wait for once no entry matches, or the only remaining match is complete
+    else if (leader_match_first == leader_match_last || (leader_match_last - leader_match_first == 1 && leader_dictionary_has_exact_match())) {
+        leader_end();
+    }
+#endif
     return true;
 }
 
@@ -84,7 +225,7 @@ void leader_reset_timer(void) {
 }
 
 bool leader_sequence_is(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
-    return leader_sequence[0] == kc1 && leader_sequence[1] == kc2 && leader_sequence[2] == kc3 && leader_sequence[3] == kc4 && leader_sequence[4] == kc5;
+    return leader_sequence_size <= 5 && leader_sequence[0] == kc1 && leader_sequence[1] == kc2 && leader_sequence[2] == kc3 && leader_sequence[3] == kc4 && leader_sequence[4] == kc5;
 }
 
 bool leader_sequence_one_key(uint16_t kc) {
@@ -1,9 +1,15 @@
 // Copyright 2023 QMK
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#pragma once
+
 #include <stdbool.h>
 #include <stdint.h>
 
+#ifndef LEADER_SEQUENCE_LENGTH
+#    define LEADER_SEQUENCE_LENGTH 5
+#endif
+
 /**
  * \file
  *
@@ -11,6 +17,44 @@
  * \{
  */
 
+#ifdef LEADER_DICTIONARY_ENABLE
+typedef enum {
+    LEADER_ENTRY_KEYCODE,
+    LEADER_ENTRY_STRING,
+    LEADER_ENTRY_ACTION,
+} leader_entry_type_t;
+
+/**
+ * \brief An entry of the leader dictionary, mapping a sequence to what it does.
+ *
+ * The dictionary is stored in PROGMEM and must be sorted by sequence, so
+ * that sequences sharing a prefix are next to each other, like the nodes of
+ * a trie. Use the `LEADER_KEYCODE()`, `LEADER_STRING()` and
+ * `LEADER_ACTION()` initializers to create entries.
+ */
+typedef struct {
+    uint16_t sequence[LEADER_SEQUENCE_LENGTH]; // zero padded
+    uint8_t  type;
+    union {
+        uint16_t    keycode;
+        const char *string;
+        void (*action)(void);
+    };
+} leader_entry_t;
+
+#    define LEADER_KEYCODE(kc, ...) {.sequence = {__VA_ARGS__}, .type = LEADER_ENTRY_KEYCODE, .keycode = (kc)}
+#    define LEADER_STRING(str, ...) {.sequence = {__VA_ARGS__}, .type = LEADER_ENTRY_STRING, .string = (str)}
+#    define LEADER_ACTION(fn, ...) {.sequence = {__VA_ARGS__}, .type = LEADER_ENTRY_ACTION, .action = (fn)}
+
+/**
+ * \brief Whether the leader dictionary is strictly sorted by sequence.
+ *
+ * Checked by the first `leader_start()`, an unsorted dictionary is matched by a
+ * linear scan once the sequence ends, instead of as each key is added.
+ */
+bool leader_dictionary_is_sorted(void);
+#endif
+
 /**
  * \brief User callback, invoked when the leader sequence begins.
  */
@@ -52,6 +96,10 @@ bool leader_sequence_active(void);
  *
  * If `LEADER_NO_TIMEOUT` is defined, the timer is reset if the buffer is empty.
  *
+ * If `LEADER_DICTIONARY_ENABLE` is defined and no dictionary entry starts with
+ * the sequence any more, or the sequence now matches an entry exactly, with no
+ * longer entry starting with it, the leader sequence ends right away.
+ *
  * \param keycode The keycode to add.
  *
  * \return `true` if the keycode was added, `false` if the buffer is full.
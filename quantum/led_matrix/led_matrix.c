@@ -68,6 +68,7 @@ uint8_t g_led_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #endif // LED_MATRIX_FRAMEBUFFER_EFFECTS
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
+uint8_t    g_last_hit_led[LED_MATRIX_LED_COUNT];
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
 // internals
@@ -80,7 +81,9 @@ static led_task_states led_task_state    = SYNCING;
 // double buffers
 static uint32_t led_timer_buffer;
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
+// ring buffer, the oldest hit is at last_hit_head
 static last_hit_t last_hit_buffer;
+static uint8_t    last_hit_head = 0;
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
 // split led matrix
@@ -170,6 +173,26 @@ void led_matrix_set_value_all(uint8_t value) {
 #endif
 }
 
+#ifdef LED_MATRIX_KEYREACTIVE_ENABLED
+// Position in last_hit_buffer of the n-th oldest hit
+static uint8_t last_hit_position(uint8_t n) {
+    uint16_t position = last_hit_head + n;
+    return position < LED_HITS_TO_REMEMBER ? position : position - LED_HITS_TO_REMEMBER;
+}
+
+static void last_hit_drop_oldest(void) {
+    last_hit_head = last_hit_position(1);
+    last_hit_buffer.count--;
+}
+
+static void last_hit_expire(void) {
+    // Ticks only ever grow, so the oldest hits expire first
+    while (last_hit_buffer.count > 0 && scale16by8(last_hit_buffer.tick[last_hit_head], led_matrix_eeconfig.speed) >= LED_HITS_EXPIRY) {
+        last_hit_drop_oldest();
+    }
+}
+#endif // LED_MATRIX_KEYREACTIVE_ENABLED
+
 void led_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
 #ifndef LED_MATRIX_SPLIT
     if (!is_keyboard_master()) return;
@@ -188,16 +211,12 @@ void led_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
         led_count = led_matrix_map_row_column_to_led(row, col, led);
     }
 
-    if (last_hit_buffer.count + led_count > LED_HITS_TO_REMEMBER) {
-        memcpy(&last_hit_buffer.x[0], &last_hit_buffer.x[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.y[0], &last_hit_buffer.y[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.tick[0], &last_hit_buffer.tick[led_count], (LED_HITS_TO_REMEMBER - led_count) * 2); // 16 bit
-        memcpy(&last_hit_buffer.index[0], &last_hit_buffer.index[led_count], LED_HITS_TO_REMEMBER - led_count);
-        last_hit_buffer.count = LED_HITS_TO_REMEMBER - led_count;
-    }
-
+    last_hit_expire();
     for (uint8_t i = 0; i < led_count; i++) {
-        uint8_t index                = last_hit_buffer.count;
+        if (last_hit_buffer.count == LED_HITS_TO_REMEMBER) {
+            last_hit_drop_oldest();
+        }
+        uint8_t index                = last_hit_position(last_hit_buffer.count);
         last_hit_buffer.x[index]     = g_led_config.point[led[i]].x;
         last_hit_buffer.y[index]     = g_led_config.point[led[i]].y;
         last_hit_buffer.index[index] = led[i];
@@ -230,14 +249,13 @@ static void led_task_timers(void) {
 
     // Update double buffer last hit timers
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
-    uint8_t count = last_hit_buffer.count;
-    for (uint8_t i = 0; i < count; ++i) {
-        if (UINT16_MAX - deltaTime < last_hit_buffer.tick[i]) {
-            last_hit_buffer.count--;
-            continue;
-        }
-        last_hit_buffer.tick[i] += deltaTime;
+    while (last_hit_buffer.count > 0 && UINT16_MAX - deltaTime < last_hit_buffer.tick[last_hit_head]) {
+        last_hit_drop_oldest();
     }
+    for (uint8_t i = 0; i < last_hit_buffer.count; ++i) {
+        last_hit_buffer.tick[last_hit_position(i)] += deltaTime;
+    }
+    last_hit_expire();
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 }
 
@@ -254,7 +272,17 @@ static void led_task_start(void) {
     // update double buffers
     g_led_timer = led_timer_buffer;
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
-    g_last_hit_tracker = last_hit_buffer;
+    g_last_hit_tracker.count = last_hit_buffer.count;
+    memset(g_last_hit_led, UINT8_MAX, sizeof(g_last_hit_led));
+    for (uint8_t i = 0; i < last_hit_buffer.count; ++i) {
+        uint8_t position            = last_hit_position(i);
+        g_last_hit_tracker.x[i]     = last_hit_buffer.x[position];
+        g_last_hit_tracker.y[i]     = last_hit_buffer.y[position];
+        g_last_hit_tracker.index[i] = last_hit_buffer.index[position];
+        g_last_hit_tracker.tick[i]  = last_hit_buffer.tick[position];
+
+        g_last_hit_led[g_last_hit_tracker.index[i]] = i;
+    }
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
     // next task
@@ -266,6 +294,9 @@ static void led_task_render(uint8_t effect) {
     led_effect_params.init = (effect != led_last_effect) || (led_matrix_eeconfig.enable != led_last_enable);
     if (led_effect_params.flags != led_matrix_eeconfig.flags) {
         led_effect_params.flags = led_matrix_eeconfig.flags;
+#ifdef LED_MATRIX_INLINE_EFFECT_RUNNERS
+        led_matrix_update_flag_leds(led_effect_params.flags);
+#endif
         led_matrix_set_value_all(0);
     }
 
@@ -448,9 +479,11 @@ void led_matrix_init(void) {
     }
 
     last_hit_buffer.count = 0;
+    last_hit_head         = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
         last_hit_buffer.tick[i] = UINT16_MAX;
     }
+    memset(g_last_hit_led, UINT8_MAX, sizeof(g_last_hit_led));
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
     eeconfig_init_led_matrix();
@@ -459,6 +492,10 @@ void led_matrix_init(void) {
         eeconfig_update_led_matrix_default();
     }
     eeconfig_debug_led_matrix(); // display current eeprom values
+
+#ifdef LED_MATRIX_INLINE_EFFECT_RUNNERS
+    led_matrix_update_flag_leds(led_effect_params.flags);
+#endif
 }
 
 void led_matrix_set_suspend_state(bool state) {
@@ -637,6 +674,10 @@ void led_matrix_decrease_speed(void) {
 
 void led_matrix_set_flags_eeprom_helper(led_flags_t flags, bool write_to_eeprom) {
     led_matrix_eeconfig.flags = flags;
+#ifdef LED_MATRIX_INLINE_EFFECT_RUNNERS
+    // also picks up changes made to g_led_config.flags at runtime
+    led_matrix_update_flag_leds(flags);
+#endif
     eeconfig_flag_led_matrix(write_to_eeprom);
     dprintf("led matrix set flags [%s]: %u\n", (write_to_eeprom) ? "EEPROM" : "NOEEPROM", led_matrix_eeconfig.flags);
 }
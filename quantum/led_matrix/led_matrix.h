@@ -89,6 +89,24 @@ struct led_matrix_limits_t led_matrix_get_limits(uint8_t iter);
 #define LED_MATRIX_TEST_LED_FLAGS() \
     if (!HAS_ANY_FLAGS(g_led_config.flags[i], params->flags)) continue
 
+// Geometry of LED i relative to the center point, looked up in the tables generated from
+// the keyboard's info.json when LED_MATRIX_LED_GEOMETRY is defined
+#ifdef LED_MATRIX_LED_GEOMETRY
+#    define LED_MATRIX_LED_DX(i) ((int16_t)pgm_read_word(&g_led_geometry[i].dx))
+#    define LED_MATRIX_LED_DY(i) ((int16_t)pgm_read_word(&g_led_geometry[i].dy))
+#    define LED_MATRIX_LED_DIST(i) pgm_read_byte(&g_led_geometry[i].dist)
+#    define LED_MATRIX_LED_ANGLE(i) pgm_read_byte(&g_led_geometry[i].angle)
+#else
+#    define LED_MATRIX_LED_DX(i) (g_led_config.point[i].x - k_led_matrix_center.x)
+#    define LED_MATRIX_LED_DY(i) (g_led_config.point[i].y - k_led_matrix_center.y)
+#    define LED_MATRIX_LED_DIST(i) sqrt16(LED_MATRIX_LED_DX(i) * LED_MATRIX_LED_DX(i) + LED_MATRIX_LED_DY(i) * LED_MATRIX_LED_DY(i))
+#    define LED_MATRIX_LED_ANGLE(i) atan2_8(LED_MATRIX_LED_DY(i), LED_MATRIX_LED_DX(i))
+#endif
+
+// The generated neighbour lists hold every LED within this distance, keyboard.c asserts they
+// were generated with the same radius
+#define LED_MATRIX_LED_NEIGHBOUR_RADIUS 40
+
 enum led_matrix_effects {
     LED_MATRIX_NONE = 0,
 
@@ -200,8 +218,19 @@ extern led_eeconfig_t led_matrix_eeconfig;
 
 extern uint32_t     g_led_timer;
 extern led_config_t g_led_config;
+#ifdef LED_MATRIX_LED_GEOMETRY
+// Generated from the keyboard's info.json, all in PROGMEM:
+//  - g_led_key: matrix position of each LED, row and col are NO_LED if it has none
+//  - g_led_neighbours: the other LEDs near LED i, closest first, are at [g_led_neighbours_offset[i], g_led_neighbours_offset[i + 1])
+extern const led_geometry_t  g_led_geometry[];
+extern const keypos_t        g_led_key[];
+extern const led_neighbour_t g_led_neighbours[];
+extern const uint16_t        g_led_neighbours_offset[];
+#endif
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
+// Position of each LED's most recent hit in g_last_hit_tracker, or UINT8_MAX
+extern uint8_t g_last_hit_led[LED_MATRIX_LED_COUNT];
 #endif
 #ifdef LED_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_led_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
@@ -31,6 +31,11 @@
 #    define LED_HITS_TO_REMEMBER 8
 #endif // LED_HITS_TO_REMEMBER
 
+// Hits are dropped once their tick scaled by the effect speed reaches this, as none of the reactive effects show them anymore
+#ifndef LED_HITS_EXPIRY
+#    define LED_HITS_EXPIRY 512
+#endif // LED_HITS_EXPIRY
+
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
 typedef struct PACKED {
     uint8_t  count;
@@ -73,6 +78,19 @@ typedef struct PACKED {
     uint8_t     flags[LED_MATRIX_LED_COUNT];
 } led_config_t;
 
+// Not packed, so the 16 bit members can be read directly from flash
+typedef struct {
+    int16_t dx;    // x - center x
+    int16_t dy;    // y - center y
+    uint8_t dist;  // sqrt16(dx * dx + dy * dy)
+    uint8_t angle; // atan2_8(dy, dx)
+} led_geometry_t;
+
+typedef struct PACKED {
+    uint8_t led;
+    uint8_t dist;
+} led_neighbour_t;
+
 typedef union led_eeconfig_t {
     uint32_t raw;
     struct PACKED {
@@ -21,6 +21,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "matrix.h"
 #include "debounce.h"
 #include "atomic_util.h"
+#ifdef MATRIX_PORT_READ
+#    include "matrix_port.h"
+#endif
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -60,6 +63,12 @@ static SPLIT_MUTABLE_ROW pin_t row_pins[ROWS_PER_HAND] = MATRIX_ROW_PINS;
 #    ifdef MATRIX_COL_PINS
 static SPLIT_MUTABLE_COL pin_t col_pins[MATRIX_COLS]   = MATRIX_COL_PINS;
 #    endif // MATRIX_COL_PINS
+#    if defined(MATRIX_PORT_READ) && defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
+#        define MATRIX_USE_PORT_MAP
+// input pins (cols for COL2ROW, rows for ROW2COL) grouped by port, when they fit
+static matrix_port_map_t input_port_map;
+static bool              input_port_map_valid = false;
+#    endif
 #endif
 
 /* matrix state(1:on, 0:off) */
@@ -181,13 +190,21 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
-    // For each col...
-    matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
-    for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
-        uint8_t pin_state = readMatrixPin(col_pins[col_index]);
-
-        // Populate the matrix row with the state of the col pin
-        current_row_value |= pin_state ? 0 : row_shifter;
+#            ifdef MATRIX_USE_PORT_MAP
+    if (input_port_map_valid) {
+        // Read all cols at once
+        current_row_value = (matrix_row_t)matrix_port_map_read(&input_port_map);
+    } else
+#            endif
+    {
+        // For each col...
+        matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+        for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
+            uint8_t pin_state = readMatrixPin(col_pins[col_index]);
+
+            // Populate the matrix row with the state of the col pin
+            current_row_value |= pin_state ? 0 : row_shifter;
+        }
     }
 
     // Unselect row
@@ -244,10 +261,19 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
+#            ifdef MATRIX_USE_PORT_MAP
+    uint32_t pressed_rows = input_port_map_valid ? matrix_port_map_read(&input_port_map) : 0;
+#            endif
+
     // For each row...
     for (uint8_t row_index = 0; row_index < ROWS_PER_HAND; row_index++) {
         // Check row pin state
-        if (readMatrixPin(row_pins[row_index]) == 0) {
+#            ifdef MATRIX_USE_PORT_MAP
+        bool pressed = input_port_map_valid ? (pressed_rows >> row_index) & 1 : readMatrixPin(row_pins[row_index]) == 0;
+#            else
+        bool pressed = readMatrixPin(row_pins[row_index]) == 0;
+#            endif
+        if (pressed) {
             // Pin LO, set col bit
             current_matrix[row_index] |= row_shifter;
             key_pressed = true;
@@ -300,6 +326,14 @@ void matrix_init(void) {
     thatHand = ROWS_PER_HAND - thisHand;
 #endif
 
+#ifdef MATRIX_USE_PORT_MAP
+#    if (DIODE_DIRECTION == COL2ROW)
+    input_port_map_valid = matrix_port_map_init(&input_port_map, col_pins, MATRIX_COLS);
+#    else
+    input_port_map_valid = matrix_port_map_init(&input_port_map, row_pins, ROWS_PER_HAND);
+#    endif
+#endif
+
     // initialize key pins
     matrix_init_pins();
 
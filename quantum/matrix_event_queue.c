@@ -0,0 +1,144 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "matrix_event_queue.h"
+#include "timer.h"
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+
+#if defined(SPLIT_KEYBOARD)
+#    error MATRIX_EVENT_QUEUE_ENABLE is not supported on split keyboards, the matrix scan also runs the split transport.
+#endif
+
+#if defined(MATRIX_HAS_GHOST)
+#    error MATRIX_EVENT_QUEUE_ENABLE is not supported together with MATRIX_HAS_GHOST.
+#endif
+
+#if (MATRIX_EVENT_QUEUE_SIZE & (MATRIX_EVENT_QUEUE_SIZE - 1)) != 0 || MATRIX_EVENT_QUEUE_SIZE > 128
+#    error MATRIX_EVENT_QUEUE_SIZE must be a power of two, up to 128.
+#endif
+
+#if defined(MATRIX_EVENT_QUEUE_THREAD) && defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#endif
+
+/* The scan stage is the only producer and matrix_task() the only consumer.
+ * The producer only writes the head and the consumer only writes the tail,
+ * each after it is done with the slot the index moves past. Both indexes run
+ * freely and are masked on access, so a full queue is distinguishable from an
+ * empty one. */
+static matrix_event_t   queue[MATRIX_EVENT_QUEUE_SIZE];
+static volatile uint8_t queue_head = 0;
+static volatile uint8_t queue_tail = 0;
+
+// Debounced state that has been turned into events, only used by the scan stage.
+static matrix_row_t matrix_queued[MATRIX_ROWS];
+
+#define QUEUE_BARRIER() __atomic_signal_fence(__ATOMIC_SEQ_CST)
+
+bool matrix_event_queue_scan(void) {
+    if (!matrix_can_read()) {
+        return false;
+    }
+
+#ifdef LATENCY_TRACE_ENABLE
+    const uint32_t trace_scanned = latency_trace_timestamp();
+#endif
+    matrix_scan();
+
+    const uint16_t now    = timer_read();
+    bool           queued = false;
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        const matrix_row_t current_row = matrix_get_row(row);
+        const matrix_row_t row_changes = current_row ^ matrix_queued[row];
+
+        if (!row_changes) {
+            continue;
+        }
+
+        matrix_row_t col_mask = 1;
+        for (uint8_t col = 0; col < MATRIX_COLS; col++, col_mask <<= 1) {
+            if (!(row_changes & col_mask)) {
+                continue;
+            }
+            if ((uint8_t)(queue_head - queue_tail) == MATRIX_EVENT_QUEUE_SIZE) {
+                return queued;
+            }
+
+            queue[queue_head & (MATRIX_EVENT_QUEUE_SIZE - 1)] = (matrix_event_t){
+                .time    = now,
+                .row     = row,
+                .col     = col,
+                .pressed = current_row & col_mask,
+#ifdef LATENCY_TRACE_ENABLE
+                .trace_scanned = trace_scanned,
+                .trace_queued  = latency_trace_timestamp(),
+#endif
+            };
+            QUEUE_BARRIER();
+            queue_head++;
+
+            matrix_queued[row] ^= col_mask;
+            queued = true;
+        }
+    }
+
+    return queued;
+}
+
+bool matrix_event_queue_pop(matrix_event_t *event) {
+    if (queue_tail == queue_head) {
+        return false;
+    }
+
+    QUEUE_BARRIER();
+    *event = queue[queue_tail & (MATRIX_EVENT_QUEUE_SIZE - 1)];
+    QUEUE_BARRIER();
+    queue_tail++;
+
+    return true;
+}
+
+#if defined(MATRIX_EVENT_QUEUE_THREAD) && defined(PROTOCOL_CHIBIOS)
+static THD_WORKING_AREA(waMatrixScanThread, 512);
+static THD_FUNCTION(MatrixScanThread, arg) {
+    (void)arg;
+    chRegSetThreadName("matrix_scan");
+
+    const sysinterval_t interval = TIME_US2I(MATRIX_EVENT_QUEUE_SCAN_INTERVAL_US);
+    systime_t           next     = chVTGetSystemTimeX();
+    while (true) {
+        const systime_t start = next;
+        matrix_event_queue_scan();
+        next = chTimeAddX(start, interval);
+
+        if (chTimeIsInRangeX(chVTGetSystemTimeX(), start, next)) {
+            chThdSleepUntilWindowed(start, next);
+        } else {
+            // The scan overran its interval. Sleeping until a deadline in the past would return immediately and
+            // starve the main loop, so always yield for a tick and restart the schedule from there.
+            chThdSleep(1);
+            next = chVTGetSystemTimeX();
+        }
+    }
+}
+#endif
+
+void matrix_event_queue_init(void) {
+    memset(matrix_queued, 0, sizeof(matrix_queued));
+    queue_head = 0;
+    queue_tail = 0;
+
+#if defined(MATRIX_EVENT_QUEUE_THREAD) && defined(PROTOCOL_CHIBIOS)
+    chThdCreateStatic(waMatrixScanThread, sizeof(waMatrixScanThread), HIGHPRIO, MatrixScanThread, NULL);
+#endif
+}
+
+void matrix_event_queue_task(void) {
+#if !(defined(MATRIX_EVENT_QUEUE_THREAD) && defined(PROTOCOL_CHIBIOS))
+    matrix_event_queue_scan();
+#endif
+}
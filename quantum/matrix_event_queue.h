@@ -0,0 +1,65 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "matrix.h"
+
+/*
+    Decouples matrix scanning from key processing. The scan stage scans and
+    debounces the matrix, and queues every change of the debounced state as an
+    event stamped with the time of the scan that saw it. matrix_task() only
+    drains the queue, so with MATRIX_EVENT_QUEUE_THREAD on ChibiOS neither the
+    scan rate nor the timestamps of key events depend on how long the rest of
+    the main loop takes.
+*/
+
+#ifndef MATRIX_EVENT_QUEUE_SIZE
+#    define MATRIX_EVENT_QUEUE_SIZE 32
+#endif
+
+// Must be longer than a matrix scan, see MatrixScanThread
+#ifndef MATRIX_EVENT_QUEUE_SCAN_INTERVAL_US
+#    define MATRIX_EVENT_QUEUE_SCAN_INTERVAL_US 1000
+#endif
+
+typedef struct {
+    uint16_t time;
+    uint8_t  row;
+    uint8_t  col;
+    bool     pressed;
+#ifdef LATENCY_TRACE_ENABLE
+    uint32_t trace_scanned;
+    uint32_t trace_queued;
+#endif
+} matrix_event_t;
+
+/**
+ * @brief Clears the queue and, with MATRIX_EVENT_QUEUE_THREAD on ChibiOS, starts the scan thread
+ */
+void matrix_event_queue_init(void);
+
+/**
+ * @brief Scans the matrix once and queues every change of the debounced state
+ *
+ * Safe to call from a timer or dedicated thread, as long as the matrix scan itself may
+ * be used from that context. Must not run concurrently with itself. Changes that do not
+ * fit in the queue are left for a later scan.
+ *
+ * @return true if any event was queued
+ */
+bool matrix_event_queue_scan(void);
+
+/**
+ * @brief Takes the oldest queued event
+ *
+ * @return false if the queue is empty
+ */
+bool matrix_event_queue_pop(matrix_event_t *event);
+
+/**
+ * @brief Scans the matrix from the main loop, unless a scan thread does so
+ */
+void matrix_event_queue_task(void);
@@ -0,0 +1,51 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "matrix_port.h"
+
+#ifdef MATRIX_PORT_READ
+
+static uint8_t find_port(matrix_port_map_t *map, gpio_port_t port) {
+    uint8_t index = 0;
+    while (index < map->port_count && map->ports[index] != port) {
+        index++;
+    }
+    if (index == map->port_count && index < MATRIX_PORT_MAX_PORTS) {
+        map->ports[map->port_count++] = port;
+    }
+    return index;
+}
+
+static uint8_t find_segment(matrix_port_map_t *map, uint8_t port, int8_t shift) {
+    uint8_t index = 0;
+    while (index < map->segment_count && (map->segments[index].port != port || map->segments[index].shift != shift)) {
+        index++;
+    }
+    if (index == map->segment_count && index < MATRIX_PORT_MAX_SEGMENTS) {
+        map->segments[map->segment_count++] = (matrix_port_segment_t){.mask = 0, .port = port, .shift = shift};
+    }
+    return index;
+}
+
+bool matrix_port_map_init(matrix_port_map_t *map, const pin_t *pins, uint8_t count) {
+    map->port_count    = 0;
+    map->segment_count = 0;
+
+    for (uint8_t i = 0; i < count; i++) {
+        if (pins[i] == NO_PIN) {
+            continue;
+        }
+
+        uint8_t port    = find_port(map, gpio_pin_port(pins[i]));
+        uint8_t segment = port < MATRIX_PORT_MAX_PORTS ? find_segment(map, port, (int8_t)(i - gpio_pin_pad(pins[i]))) : MATRIX_PORT_MAX_SEGMENTS;
+        if (i >= 32 || segment == MATRIX_PORT_MAX_SEGMENTS) {
+            map->port_count    = 0;
+            map->segment_count = 0;
+            return false;
+        }
+        map->segments[segment].mask |= (gpio_port_value_t)1 << gpio_pin_pad(pins[i]);
+    }
+    return true;
+}
+
+#endif // MATRIX_PORT_READ
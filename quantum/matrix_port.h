@@ -0,0 +1,77 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio.h"
+
+/*
+    Reads a list of matrix input pins with one register read per GPIO port.
+
+    The pins are grouped by port, and within a port into segments of pins
+    whose position in the list is at a constant offset from their pad number,
+    e.g. columns 0-7 wired to PB8-PB15 form a single segment shifted right by
+    8. Reading the list then costs one port read per port, plus one mask and
+    shift per segment.
+*/
+
+#ifndef MATRIX_PORT_MAX_PORTS
+#    define MATRIX_PORT_MAX_PORTS 4
+#endif
+
+#ifndef MATRIX_PORT_MAX_SEGMENTS
+#    define MATRIX_PORT_MAX_SEGMENTS 8
+#endif
+
+#ifndef MATRIX_INPUT_PRESSED_STATE
+#    define MATRIX_INPUT_PRESSED_STATE 0
+#endif
+
+typedef struct {
+    gpio_port_value_t mask;  // pads of the port that belong to this segment
+    uint8_t           port;  // index into the ports of the map
+    int8_t            shift; // position in the pin list = pad + shift
+} matrix_port_segment_t;
+
+typedef struct {
+    uint8_t               port_count;
+    uint8_t               segment_count;
+    gpio_port_t           ports[MATRIX_PORT_MAX_PORTS];
+    matrix_port_segment_t segments[MATRIX_PORT_MAX_SEGMENTS];
+} matrix_port_map_t;
+
+/**
+ * @brief Groups a list of input pins by port. NO_PIN entries always read as released.
+ *
+ * @return false if the pins need more ports or segments than configured, in
+ * which case the map is left empty and the pins should be read one by one
+ */
+bool matrix_port_map_init(matrix_port_map_t *map, const pin_t *pins, uint8_t count);
+
+/**
+ * @brief Reads the pins of a map.
+ *
+ * @return a bitmask with bit n set when the n-th pin of the list is in the pressed state
+ */
+static inline uint32_t matrix_port_map_read(const matrix_port_map_t *map) {
+    gpio_port_value_t values[MATRIX_PORT_MAX_PORTS];
+    uint32_t          pressed = 0;
+
+    for (uint8_t i = 0; i < map->port_count; i++) {
+#if MATRIX_INPUT_PRESSED_STATE == 0
+        values[i] = ~gpio_read_port(map->ports[i]);
+#else
+        values[i] = gpio_read_port(map->ports[i]);
+#endif
+    }
+
+    for (uint8_t i = 0; i < map->segment_count; i++) {
+        const matrix_port_segment_t *segment = &map->segments[i];
+        uint32_t                     pads    = values[segment->port] & segment->mask;
+
+        pressed |= segment->shift >= 0 ? pads << segment->shift : pads >> -segment->shift;
+    }
+    return pressed;
+}
@@ -72,6 +72,15 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_PIXDATA_ASYNC
+/**
+ * @def This controls whether pixel data is transmitted in the background on comms drivers that support it, such as
+ *      SPI on ChibiOS. A second pixel data buffer is allocated so that the next block can be decoded while the
+ *      previous one is being transmitted, doubling the RAM used by QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE.
+ */
+#    define QUANTUM_PAINTER_PIXDATA_ASYNC FALSE
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -10,7 +10,17 @@
 // Quantum Painter utility functions
 
 // Global variable used for native pixel data streaming.
+#if QUANTUM_PAINTER_PIXDATA_ASYNC
+// Pixel data handed to the driver may still be in transmission until the next comms call, so anything filling the buffer
+// after sending it within the same operation needs to swap to the other buffer first.
+extern uint8_t *qp_internal_global_pixdata_buffer;
+void            qp_internal_swap_pixdata_buffer(void);
+#else
 extern uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#    define qp_internal_swap_pixdata_buffer() \
+        do {                                  \
+        } while (0)
+#endif
 
 // Check if the supplied bpp is capable of being rendered
 bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
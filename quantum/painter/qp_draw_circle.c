@@ -7,116 +7,59 @@
 #include "qp_comms.h"
 #include "qp_draw.h"
 
-// Utilize 8-way symmetry to draw circles
-static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+// Utilize 8-way symmetry to draw circles as horizontal and vertical spans
+static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx0, uint16_t offsetx1, uint16_t offsety, bool filled) {
     /*
-    Circles have the property of 8-way symmetry, so eight pixels can be drawn
+    Circles have the property of 8-way symmetry, so eight points can be drawn
     for each computed [offsetx,offsety] given the center coordinates
     represented by [centerx,centery].
 
-    For filled circles, we can draw horizontal lines between each pair of
-    pixels with the same final value of y.
+    This is called once for each run of computed points sharing the same
+    offsety, with offsetx ranging from [offsetx0,offsetx1]. Along the top and
+    bottom of the circle the run is a horizontal span, and along the sides it
+    is a vertical span, so each can be drawn as a single-width rect instead of
+    pixel by pixel.
 
-    Two special cases exist and have been optimized:
-    1) offsetx == offsety (the final point), makes half the coordinates
-    equivalent, so we can omit them (and the corresponding fill lines)
-    2) offsetx == 0 (the starting point) means that some horizontal lines
-    would be a single pixel in length, so we write individual pixels instead.
-    This also makes half the symmetrical points identical to their twins,
-    so we only need four points or two points and one line
+    For filled circles, the rows at +/-offsety are as wide as the widest point
+    of the run, and the rows at +/-offsetx are all 2*offsety+1 wide, so they
+    make up a single rect above and below the center.
     */
 
-    int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
-    int16_t xmx = ((int16_t)centerx) - ((int16_t)offsetx);
-    int16_t xpy = ((int16_t)centerx) + ((int16_t)offsety);
-    int16_t xmy = ((int16_t)centerx) - ((int16_t)offsety);
-    int16_t ypx = ((int16_t)centery) + ((int16_t)offsetx);
-    int16_t ymx = ((int16_t)centery) - ((int16_t)offsetx);
-    int16_t ypy = ((int16_t)centery) + ((int16_t)offsety);
-    int16_t ymy = ((int16_t)centery) - ((int16_t)offsety);
-
-    if (offsetx == 0) {
-        if (!qp_internal_setpixel_impl(device, centerx, ypy)) {
+    int16_t xpx0 = ((int16_t)centerx) + ((int16_t)offsetx0);
+    int16_t xpx1 = ((int16_t)centerx) + ((int16_t)offsetx1);
+    int16_t xmx0 = ((int16_t)centerx) - ((int16_t)offsetx0);
+    int16_t xmx1 = ((int16_t)centerx) - ((int16_t)offsetx1);
+    int16_t xpy  = ((int16_t)centerx) + ((int16_t)offsety);
+    int16_t xmy  = ((int16_t)centerx) - ((int16_t)offsety);
+    int16_t ypx0 = ((int16_t)centery) + ((int16_t)offsetx0);
+    int16_t ypx1 = ((int16_t)centery) + ((int16_t)offsetx1);
+    int16_t ymx0 = ((int16_t)centery) - ((int16_t)offsetx0);
+    int16_t ymx1 = ((int16_t)centery) - ((int16_t)offsetx1);
+    int16_t ypy  = ((int16_t)centery) + ((int16_t)offsety);
+    int16_t ymy  = ((int16_t)centery) - ((int16_t)offsety);
+
+    if (filled) {
+        if (!qp_internal_fillrect_helper_impl(device, xmx1, ypy, xpx1, ypy)) {
             return false;
         }
-        if (!qp_internal_setpixel_impl(device, centerx, ymy)) {
+        if (offsety > 0 && !qp_internal_fillrect_helper_impl(device, xmx1, ymy, xpx1, ymy)) {
             return false;
         }
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, centery, xmy, centery)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpy, centery)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, centery)) {
-                return false;
-            }
-        }
-    } else if (offsetx == offsety) {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypy, xmy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymy, xmy, ymy)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ymy)) {
-                return false;
-            }
+        if (offsetx0 == 0) {
+            // The rows above and below the center join up
+            return qp_internal_fillrect_helper_impl(device, xmy, ymx1, xpy, ypx1);
         }
+        return qp_internal_fillrect_helper_impl(device, xmy, ypx0, xpy, ypx1) && qp_internal_fillrect_helper_impl(device, xmy, ymx1, xpy, ymx0);
+    }
 
-    } else {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypx, xmy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymx, xmy, ymx)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ymx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ymx)) {
-                return false;
-            }
-        }
+    // Top and bottom
+    if (!qp_internal_fillrect_helper_impl(device, xpx0, ypy, xpx1, ypy) || !qp_internal_fillrect_helper_impl(device, xmx1, ypy, xmx0, ypy) || !qp_internal_fillrect_helper_impl(device, xpx0, ymy, xpx1, ymy) || !qp_internal_fillrect_helper_impl(device, xmx1, ymy, xmx0, ymy)) {
+        return false;
+    }
+
+    // Sides
+    if (!qp_internal_fillrect_helper_impl(device, xpy, ypx0, xpy, ypx1) || !qp_internal_fillrect_helper_impl(device, xpy, ymx1, xpy, ymx0) || !qp_internal_fillrect_helper_impl(device, xmy, ypx0, xmy, ypx1) || !qp_internal_fillrect_helper_impl(device, xmy, ymx1, xmy, ymx0)) {
+        return false;
     }
 
     return true;
@@ -134,38 +77,44 @@ bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius,
     }
 
     // plot the initial set of points for x, y and r
-    int16_t xcalc = 0;
-    int16_t ycalc = (int16_t)radius;
-    int16_t err   = ((5 - (radius >> 2)) >> 2);
-
-    qp_internal_fill_pixdata(device, (radius * 2) + 1, hue, sat, val);
+    int16_t xcalc  = 0;
+    int16_t ycalc  = (int16_t)radius;
+    int16_t err    = ((5 - (radius >> 2)) >> 2);
+    int16_t xstart = 0;
+
+    // Filled circles are drawn as rects up to the full diameter wide
+    if (filled) {
+        qp_internal_fill_pixdata(device, ((radius * 2) + 1) * ((radius * 2) + 1), hue, sat, val);
+    } else {
+        qp_internal_fill_pixdata(device, (radius * 2) + 1, hue, sat, val);
+    }
 
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_circle: fail (could not start comms)\n");
         return false;
     }
 
+    // Points are accumulated until ycalc changes, and each run is drawn as a whole
     bool ret = true;
-    if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
-        ret = false;
-    }
-
-    if (ret) {
-        while (xcalc < ycalc) {
-            xcalc++;
-            if (err < 0) {
-                err += (xcalc << 1) + 1;
-            } else {
-                ycalc--;
-                err += ((xcalc - ycalc) << 1) + 1;
-            }
-            if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
+    while (xcalc < ycalc) {
+        xcalc++;
+        if (err < 0) {
+            err += (xcalc << 1) + 1;
+        } else {
+            if (!qp_circle_helper_impl(device, x, y, xstart, xcalc - 1, ycalc, filled)) {
                 ret = false;
                 break;
             }
+            xstart = xcalc;
+            ycalc--;
+            err += ((xcalc - ycalc) << 1) + 1;
         }
     }
 
+    if (ret && !qp_circle_helper_impl(device, x, y, xstart, xcalc, ycalc, filled)) {
+        ret = false;
+    }
+
     qp_dprintf("qp_circle: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
     return ret;
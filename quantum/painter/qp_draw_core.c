@@ -21,7 +21,13 @@ STATIC_ASSERT((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIXD
 //
 
 // Buffer used for transmitting native pixel data to the downstream device.
+#if QUANTUM_PAINTER_PIXDATA_ASYNC
+// Two buffers, so that the next block of pixel data can be generated while the previous one is still being transmitted.
+__attribute__((__aligned__(4))) static uint8_t qp_internal_pixdata_buffers[2][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+uint8_t                                        *qp_internal_global_pixdata_buffer = qp_internal_pixdata_buffers[0];
+#else
 __attribute__((__aligned__(4))) uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif
 
 // Static buffer to contain a generated color palette
 static bool                                       generated_palette = false;
@@ -42,6 +48,14 @@ uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device) {
     return ((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE * 8) / driver->native_bits_per_pixel);
 }
 
+#if QUANTUM_PAINTER_PIXDATA_ASYNC
+// Switches the global pixdata buffer to the one not handed to the driver most recently. A comms driver only has one
+// transfer in flight at any time, and waits for it to complete before starting the next, so this buffer is free again.
+void qp_internal_swap_pixdata_buffer(void) {
+    qp_internal_global_pixdata_buffer = (qp_internal_global_pixdata_buffer == qp_internal_pixdata_buffers[0]) ? qp_internal_pixdata_buffers[1] : qp_internal_pixdata_buffers[0];
+}
+#endif
+
 // qp_setpixel internal implementation, but accepts a buffer with pre-converted native pixel. Only the first pixel is used.
 bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y) {
     painter_driver_t *driver = (painter_driver_t *)device;
@@ -58,11 +72,24 @@ void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint
     qp_pixel_t color = {.hsv888 = {.h = hue, .s = sat, .v = val}};
     driver->driver_vtable->palette_convert(device, 1, &color);
 
-    // Append the required number of pixels
+    // Append just enough pixels to end on a byte boundary, e.g. 1 for RGB565/RGB888 or 8 for 1bpp mono
+    uint8_t pattern_pixels = 1;
+    while ((pattern_pixels * driver->native_bits_per_pixel) % 8 != 0) {
+        pattern_pixels <<= 1;
+    }
     uint8_t palette_idx = 0;
-    for (uint32_t i = 0; i < num_pixels; ++i) {
+    for (uint8_t i = 0; i < pattern_pixels; ++i) {
         driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, &color, i, 1, &palette_idx);
     }
+
+    // ...then replicate those bytes, doubling the amount copied each time, instead of appending every pixel individually
+    uint32_t filled_bytes = pattern_pixels * driver->native_bits_per_pixel / 8;
+    uint32_t total_bytes  = (num_pixels * driver->native_bits_per_pixel + 7) / 8;
+    while (filled_bytes < total_bytes) {
+        uint32_t copy_bytes = QP_MIN(filled_bytes, total_bytes - filled_bytes);
+        memcpy(&qp_internal_global_pixdata_buffer[filled_bytes], qp_internal_global_pixdata_buffer, copy_bytes);
+        filled_bytes += copy_bytes;
+    }
 }
 
 // Resets the global palette so that it can be regenerated. Only needed if the colors are identical, but a different display is used with a different internal pixel format.
@@ -6,51 +6,52 @@
 #include "qp_comms.h"
 #include "qp_draw.h"
 
-// Utilize 4-way symmetry to draw an ellipse
-static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+// Utilize 4-way symmetry to draw an ellipse as horizontal and vertical spans
+static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx0, uint16_t offsetx1, uint16_t offsety0, uint16_t offsety1, bool filled) {
     /*
-    Ellipses have the property of 4-way symmetry, so four pixels can be drawn
+    Ellipses have the property of 4-way symmetry, so four points can be drawn
     for each computed [offsetx,offsety] given the center coordinates
     represented by [centerx,centery].
 
-    For filled ellipses, we can draw horizontal lines between each pair of
-    pixels with the same final value of y.
+    This is called once for each run of computed points, which either share
+    the same offsety (a horizontal span along the top and bottom) or the same
+    offsetx (a vertical span along the sides), so each can be drawn as a
+    single-width rect instead of pixel by pixel.
 
-    When offsetx == 0 only two pixels can be drawn for filled or unfilled ellipses
-    */
+    For filled ellipses, the rows covered by the run are as wide as the widest
+    point of the run, so they make up a single rect above and below the center.
 
-    int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
-    int16_t xmx = ((int16_t)centerx) - ((int16_t)offsetx);
-    int16_t ypy = ((int16_t)centery) + ((int16_t)offsety);
-    int16_t ymy = ((int16_t)centery) - ((int16_t)offsety);
+    Mirrored spans that would land on the same pixels are omitted.
+    */
 
-    if (offsetx == 0) {
-        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-            return false;
-        }
-    } else if (filled) {
-        if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
-            return false;
-        }
-        if (offsety > 0 && !qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
-            return false;
-        }
-    } else {
-        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
-            return false;
+    int16_t xpx0 = ((int16_t)centerx) + ((int16_t)offsetx0);
+    int16_t xpx1 = ((int16_t)centerx) + ((int16_t)offsetx1);
+    int16_t xmx0 = ((int16_t)centerx) - ((int16_t)offsetx0);
+    int16_t xmx1 = ((int16_t)centerx) - ((int16_t)offsetx1);
+    int16_t ypy0 = ((int16_t)centery) + ((int16_t)offsety0);
+    int16_t ypy1 = ((int16_t)centery) + ((int16_t)offsety1);
+    int16_t ymy0 = ((int16_t)centery) - ((int16_t)offsety0);
+    int16_t ymy1 = ((int16_t)centery) - ((int16_t)offsety1);
+
+    if (filled) {
+        if (offsety0 == 0) {
+            // The rows above and below the center join up
+            return qp_internal_fillrect_helper_impl(device, xmx1, ymy1, xpx1, ypy1);
         }
+        return qp_internal_fillrect_helper_impl(device, xmx1, ypy0, xpx1, ypy1) && qp_internal_fillrect_helper_impl(device, xmx1, ymy1, xpx1, ymy0);
+    }
+
+    if (!qp_internal_fillrect_helper_impl(device, xpx0, ypy0, xpx1, ypy1)) {
+        return false;
+    }
+    if (offsetx1 > 0 && !qp_internal_fillrect_helper_impl(device, xmx1, ypy0, xmx0, ypy1)) {
+        return false;
+    }
+    if (offsety1 > 0 && !qp_internal_fillrect_helper_impl(device, xpx0, ymy1, xpx1, ymy0)) {
+        return false;
+    }
+    if (offsetx1 > 0 && offsety1 > 0 && !qp_internal_fillrect_helper_impl(device, xmx1, ymy1, xmx0, ymy0)) {
+        return false;
     }
 
     return true;
@@ -75,40 +76,57 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
     int16_t dx = 0;
     int16_t dy = ((int16_t)sizey);
 
-    qp_internal_fill_pixdata(device, QP_MAX(sizex, sizey), hue, sat, val);
+    // Filled ellipses are drawn as rects up to the full width wide
+    if (filled) {
+        qp_internal_fill_pixdata(device, ((sizex * 2) + 1) * ((sizey * 2) + 1), hue, sat, val);
+    } else {
+        qp_internal_fill_pixdata(device, QP_MAX(sizex, sizey) + 1, hue, sat, val);
+    }
 
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_ellipse: fail (could not start comms)\n");
         return false;
     }
 
-    bool ret = true;
+    // Points are accumulated until dy changes, and each run is drawn as a whole
+    bool    ret    = true;
+    int16_t xstart = 0;
     for (int32_t delta = (2 * bb) + (aa * (1 - (2 * sizey))); bb * dx <= aa * dy; dx++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
-            ret = false;
-            break;
-        }
         if (delta >= 0) {
+            if (!qp_ellipse_helper_impl(device, x, y, xstart, dx, dy, dy, filled)) {
+                ret = false;
+                break;
+            }
+            xstart = dx + 1;
             delta += fa * (1 - dy);
             dy--;
         }
         delta += bb * (4 * dx + 6);
     }
+    if (ret && xstart < dx && !qp_ellipse_helper_impl(device, x, y, xstart, dx - 1, dy, dy, filled)) {
+        ret = false;
+    }
 
     dx = sizex;
     dy = 0;
 
-    for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); aa * dy <= bb * dx; dy++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
-            ret = false;
-            break;
-        }
+    // Points are accumulated until dx changes, and each run is drawn as a whole
+    int16_t ystart = 0;
+    for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); ret && aa * dy <= bb * dx; dy++) {
         if (delta >= 0) {
+            if (!qp_ellipse_helper_impl(device, x, y, dx, dx, ystart, dy, filled)) {
+                ret = false;
+                break;
+            }
+            ystart = dy + 1;
             delta += fb * (1 - dx);
             dx--;
         }
         delta += aa * (4 * dy + 6);
     }
+    if (ret && ystart < dy && !qp_ellipse_helper_impl(device, x, y, dx, dx, ystart, dy - 1, filled)) {
+        ret = false;
+    }
 
     qp_dprintf("qp_ellipse: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
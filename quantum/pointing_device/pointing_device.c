@@ -186,6 +186,9 @@ __attribute__((weak)) void pointing_device_init(void) {
 #    else
         gpio_set_pin_input(POINTING_DEVICE_MOTION_PIN);
 #    endif
+#endif
+#ifdef POINTING_DEVICE_SAMPLING_ENABLE
+        pointing_device_sampling_init();
 #endif
     }
 #ifdef POINTING_DEVICE_HIRES_SCROLL_ENABLE
@@ -273,6 +276,11 @@ __attribute__((weak)) bool pointing_device_task(void) {
     };
 #endif
 
+#if defined(POINTING_DEVICE_SAMPLING_ENABLE) && !defined(POINTING_DEVICE_SAMPLING_THREAD)
+    // Sample at the loop rate, even when the report itself is throttled.
+    pointing_device_sample();
+#endif
+
 #if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
     static uint32_t last_exec = 0;
     if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
@@ -282,36 +290,40 @@ __attribute__((weak)) bool pointing_device_task(void) {
 #endif
 
     // Gather report info
-#ifdef POINTING_DEVICE_MOTION_PIN
-#    if defined(SPLIT_POINTING_ENABLE)
-#        error POINTING_DEVICE_MOTION_PIN not supported when sharing the pointing device report between sides.
-#    endif
-#    ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+#if defined(POINTING_DEVICE_SAMPLING_ENABLE)
+    local_mouse_report = pointing_device_sampling_drain(local_mouse_report);
+#else
+#    ifdef POINTING_DEVICE_MOTION_PIN
+#        if defined(SPLIT_POINTING_ENABLE)
+#            error POINTING_DEVICE_MOTION_PIN not supported when sharing the pointing device report between sides.
+#        endif
+#        ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
     if (!gpio_read_pin(POINTING_DEVICE_MOTION_PIN))
-#    else
+#        else
     if (gpio_read_pin(POINTING_DEVICE_MOTION_PIN))
-#    endif
+#        endif
     {
-#endif
+#    endif
 
-#if defined(SPLIT_POINTING_ENABLE)
-#    if defined(POINTING_DEVICE_COMBINED)
+#    if defined(SPLIT_POINTING_ENABLE)
+#        if defined(POINTING_DEVICE_COMBINED)
         static uint8_t old_buttons = 0;
         local_mouse_report.buttons = old_buttons;
         local_mouse_report         = pointing_device_driver->get_report(local_mouse_report);
         old_buttons                = local_mouse_report.buttons;
-#    elif defined(POINTING_DEVICE_LEFT) || defined(POINTING_DEVICE_RIGHT)
+#        elif defined(POINTING_DEVICE_LEFT) || defined(POINTING_DEVICE_RIGHT)
         local_mouse_report = POINTING_DEVICE_THIS_SIDE ? pointing_device_driver->get_report(local_mouse_report) : shared_mouse_report;
+#        else
+#            error "You need to define the side(s) the pointing device is on. POINTING_DEVICE_COMBINED / POINTING_DEVICE_LEFT / POINTING_DEVICE_RIGHT"
+#        endif
 #    else
-#        error "You need to define the side(s) the pointing device is on. POINTING_DEVICE_COMBINED / POINTING_DEVICE_LEFT / POINTING_DEVICE_RIGHT"
-#    endif
-#else
     local_mouse_report = pointing_device_driver->get_report(local_mouse_report);
-#endif // defined(SPLIT_POINTING_ENABLE)
+#    endif // defined(SPLIT_POINTING_ENABLE)
 
-#ifdef POINTING_DEVICE_MOTION_PIN
+#    ifdef POINTING_DEVICE_MOTION_PIN
     }
-#endif
+#    endif
+#endif // defined(POINTING_DEVICE_SAMPLING_ENABLE)
 
     // allow kb to intercept and modify report
 #if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
@@ -327,6 +339,9 @@ __attribute__((weak)) bool pointing_device_task(void) {
     local_mouse_report = pointing_device_adjust_by_defines(local_mouse_report);
 #endif
     local_mouse_report = pointing_device_task_modules(local_mouse_report);
+#ifdef POINTING_DEVICE_ACCELERATION_ENABLE
+    local_mouse_report = pointing_device_task_acceleration(local_mouse_report);
+#endif
     local_mouse_report = pointing_device_task_kb(local_mouse_report);
     // automatic mouse layer function
 #ifdef POINTING_DEVICE_AUTO_MOUSE_ENABLE
@@ -374,7 +389,10 @@ uint16_t pointing_device_get_cpi(void) {
 #if defined(SPLIT_POINTING_ENABLE)
     return POINTING_DEVICE_THIS_SIDE ? pointing_device_driver->get_cpi() : shared_cpi;
 #else
-    return pointing_device_driver->get_cpi();
+    pointing_device_sampling_lock();
+    uint16_t cpi = pointing_device_driver->get_cpi();
+    pointing_device_sampling_unlock();
+    return cpi;
 #endif
 }
 
@@ -393,7 +411,9 @@ void pointing_device_set_cpi(uint16_t cpi) {
         shared_cpi = cpi;
     }
 #else
+    pointing_device_sampling_lock();
     pointing_device_driver->set_cpi(cpi);
+    pointing_device_sampling_unlock();
 #endif
 }
 
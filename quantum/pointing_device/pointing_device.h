@@ -33,6 +33,10 @@ typedef struct {
 #    include "pointing_device_auto_mouse.h"
 #endif
 
+#include "pointing_device_sampling.h"
+
+#include "pointing_device_acceleration.h"
+
 #if defined(POINTING_DEVICE_DRIVER_adns5050)
 #    include "drivers/sensors/adns5050.h"
 #    define POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
@@ -0,0 +1,148 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "pointing_device.h"
+#include "pointing_device_acceleration.h"
+#include "util.h"
+
+/**
+ * @brief Looks up the gain for a given speed on a piecewise-linear curve
+ *
+ * @param[in] curve points sorted by ascending speed
+ * @param[in] curve_length number of points in curve
+ * @param[in] speed counts per report
+ * @return uint16_t Q8.8 gain
+ */
+uint16_t pointing_device_accel_gain(const pointing_device_accel_point_t *curve, uint8_t curve_length, uint16_t speed) {
+    if (curve_length == 0) {
+        return POINTING_DEVICE_ACCEL_GAIN(1, 0);
+    }
+    if (speed <= curve[0].speed) {
+        return curve[0].gain;
+    }
+    for (uint8_t i = 1; i < curve_length; i++) {
+        if (speed <= curve[i].speed) {
+            int32_t span = curve[i].speed - curve[i - 1].speed;
+            int32_t rise = (int32_t)curve[i].gain - curve[i - 1].gain;
+            return curve[i - 1].gain + (rise * (speed - curve[i - 1].speed)) / span;
+        }
+    }
+    return curve[curve_length - 1].gain;
+}
+
+// Largest motion scaled, the extended report range. Times any Q8.8 gain, it still fits in 32 bits.
+#define POINTING_DEVICE_ACCEL_VALUE_MAX 32767
+
+static inline int32_t pointing_device_accel_scale(int32_t value, uint16_t gain, int16_t *remainder) {
+    if (value > POINTING_DEVICE_ACCEL_VALUE_MAX) {
+        value = POINTING_DEVICE_ACCEL_VALUE_MAX;
+    } else if (value < -POINTING_DEVICE_ACCEL_VALUE_MAX) {
+        value = -POINTING_DEVICE_ACCEL_VALUE_MAX;
+    }
+    int32_t scaled = value * gain + *remainder;
+    // Rounds towards negative infinity, the carried fraction is always in [0, 256).
+    int32_t whole = scaled >> 8;
+    *remainder    = scaled & 0xFF;
+    return whole;
+}
+
+/**
+ * @brief Applies an acceleration curve to a pair of axes
+ *
+ * Speed is approximated as max + min / 2 of both axes, which stays within 12% of the
+ * true magnitude without a square root. Fractional counts are carried per axis, so
+ * slow movement with a gain below 1.0 is not lost. Motion beyond the extended report
+ * range of +/-32767 is limited to it before scaling.
+ *
+ * @param[in] accel curve and per-axis remainder state
+ * @param[in,out] a first axis (x or h)
+ * @param[in,out] b second axis (y or v)
+ */
+void pointing_device_accel_apply(pointing_device_accel_t *accel, int32_t *a, int32_t *b) {
+    uint32_t abs_a = *a < 0 ? 0u - (uint32_t)*a : (uint32_t)*a;
+    uint32_t abs_b = *b < 0 ? 0u - (uint32_t)*b : (uint32_t)*b;
+    uint32_t speed = MAX(abs_a, abs_b) + MIN(abs_a, abs_b) / 2;
+    uint16_t gain  = pointing_device_accel_gain(accel->curve, accel->curve_length, MIN(speed, UINT16_MAX));
+
+    *a = pointing_device_accel_scale(*a, gain, &accel->remainder_a);
+    *b = pointing_device_accel_scale(*b, gain, &accel->remainder_b);
+}
+
+/**
+ * @brief Discards any carried fractional counts
+ */
+void pointing_device_accel_reset(pointing_device_accel_t *accel) {
+    accel->remainder_a = 0;
+    accel->remainder_b = 0;
+}
+
+#ifdef POINTING_DEVICE_ACCELERATION_ENABLE
+
+#    ifndef POINTING_DEVICE_ACCELERATION_CURVE
+#        define POINTING_DEVICE_ACCELERATION_CURVE \
+            { {4, POINTING_DEVICE_ACCEL_GAIN(1, 0)}, {16, POINTING_DEVICE_ACCEL_GAIN(2, 0)}, {48, POINTING_DEVICE_ACCEL_GAIN(3, 0)} }
+#    endif
+
+static const pointing_device_accel_point_t pointer_curve[] = POINTING_DEVICE_ACCELERATION_CURVE;
+static pointing_device_accel_t             pointer_accel   = {.curve = pointer_curve, .curve_length = ARRAY_SIZE(pointer_curve)};
+
+#    ifdef POINTING_DEVICE_ACCELERATION_SCROLL_CURVE
+static const pointing_device_accel_point_t scroll_curve[] = POINTING_DEVICE_ACCELERATION_SCROLL_CURVE;
+static pointing_device_accel_t             scroll_accel   = {.curve = scroll_curve, .curve_length = ARRAY_SIZE(scroll_curve)};
+#    endif
+
+static bool acceleration_enabled = true;
+
+static inline mouse_xy_report_t accel_xy_clamp(int32_t value) {
+    return value < MOUSE_REPORT_XY_MIN ? MOUSE_REPORT_XY_MIN : (value > MOUSE_REPORT_XY_MAX ? MOUSE_REPORT_XY_MAX : value);
+}
+
+#    ifdef POINTING_DEVICE_ACCELERATION_SCROLL_CURVE
+static inline mouse_hv_report_t accel_hv_clamp(int32_t value) {
+    return value < MOUSE_REPORT_HV_MIN ? MOUSE_REPORT_HV_MIN : (value > MOUSE_REPORT_HV_MAX ? MOUSE_REPORT_HV_MAX : value);
+}
+#    endif
+
+/**
+ * @brief Applies the configured acceleration curves to a mouse report
+ *
+ * Called by pointing_device_task before pointing_device_task_kb.
+ *
+ * @param[in] mouse_report report_mouse_t
+ * @return report_mouse_t with accelerated motion
+ */
+report_mouse_t pointing_device_task_acceleration(report_mouse_t mouse_report) {
+    if (!acceleration_enabled) {
+        return mouse_report;
+    }
+
+    int32_t x = mouse_report.x;
+    int32_t y = mouse_report.y;
+    pointing_device_accel_apply(&pointer_accel, &x, &y);
+    mouse_report.x = accel_xy_clamp(x);
+    mouse_report.y = accel_xy_clamp(y);
+
+#    ifdef POINTING_DEVICE_ACCELERATION_SCROLL_CURVE
+    int32_t h = mouse_report.h;
+    int32_t v = mouse_report.v;
+    pointing_device_accel_apply(&scroll_accel, &h, &v);
+    mouse_report.h = accel_hv_clamp(h);
+    mouse_report.v = accel_hv_clamp(v);
+#    endif
+
+    return mouse_report;
+}
+
+void pointing_device_set_acceleration_enabled(bool enabled) {
+    acceleration_enabled = enabled;
+    pointing_device_accel_reset(&pointer_accel);
+#    ifdef POINTING_DEVICE_ACCELERATION_SCROLL_CURVE
+    pointing_device_accel_reset(&scroll_accel);
+#    endif
+}
+
+bool pointing_device_get_acceleration_enabled(void) {
+    return acceleration_enabled;
+}
+
+#endif
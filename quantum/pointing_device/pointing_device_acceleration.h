@@ -0,0 +1,39 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "report.h"
+
+/* Gains are unsigned Q8.8 fixed point, i.e. 256 is a gain of 1.0. */
+#define POINTING_DEVICE_ACCEL_GAIN(whole, frac256) ((uint16_t)(((whole) << 8) | (frac256)))
+
+/**
+ * @brief A single point on a piecewise-linear acceleration curve
+ *
+ * Below the first point the gain of the first point applies, above the last point
+ * the gain of the last point applies, and in between the gain is interpolated.
+ */
+typedef struct {
+    uint16_t speed; /* counts per report */
+    uint16_t gain;  /* Q8.8 */
+} pointing_device_accel_point_t;
+
+typedef struct {
+    const pointing_device_accel_point_t *curve;
+    uint8_t                              curve_length;
+    int16_t                              remainder_a; /* Q8.8 fraction carried into the next report */
+    int16_t                              remainder_b;
+} pointing_device_accel_t;
+
+uint16_t pointing_device_accel_gain(const pointing_device_accel_point_t *curve, uint8_t curve_length, uint16_t speed);
+void     pointing_device_accel_apply(pointing_device_accel_t *accel, int32_t *a, int32_t *b);
+void     pointing_device_accel_reset(pointing_device_accel_t *accel);
+
+#ifdef POINTING_DEVICE_ACCELERATION_ENABLE
+report_mouse_t pointing_device_task_acceleration(report_mouse_t mouse_report);
+void           pointing_device_set_acceleration_enabled(bool enabled);
+bool           pointing_device_get_acceleration_enabled(void);
+#endif
@@ -0,0 +1,187 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "pointing_device.h"
+#include "pointing_device_sampling.h"
+#include "gpio.h"
+
+#ifdef POINTING_DEVICE_SAMPLING_ENABLE
+
+#    if defined(SPLIT_POINTING_ENABLE)
+#        error POINTING_DEVICE_SAMPLING_ENABLE is not supported when sharing the pointing device report between sides.
+#    endif
+
+#    if defined(POINTING_DEVICE_SAMPLING_THREAD) && defined(PROTOCOL_CHIBIOS)
+#        include <ch.h>
+#        include <hal.h>
+#        if (HAL_USE_I2C == TRUE && I2C_USE_MUTUAL_EXCLUSION != TRUE) || (HAL_USE_SPI == TRUE && SPI_USE_MUTUAL_EXCLUSION != TRUE)
+#            error POINTING_DEVICE_SAMPLING_THREAD requires I2C_USE_MUTUAL_EXCLUSION and SPI_USE_MUTUAL_EXCLUSION for the buses in use.
+#        endif
+#    endif
+
+extern const pointing_device_driver_t *pointing_device_driver;
+
+/* The sampling stage is the only writer of the accumulator and the report
+ * stage is the only reader. Totals only ever grow (wrapping), and the reader
+ * keeps its own drained totals, so no state is shared in the other direction.
+ * The sequence counter is odd while an update is in progress; the reader
+ * retries if it observes an odd or changed sequence. */
+typedef struct {
+    volatile uint8_t sequence;
+    uint32_t         x;
+    uint32_t         y;
+    uint32_t         h;
+    uint32_t         v;
+    uint8_t          buttons;
+} pointing_device_accumulator_t;
+
+static pointing_device_accumulator_t accumulator = {0};
+
+static uint32_t drained_x       = 0;
+static uint32_t drained_y       = 0;
+static uint32_t drained_h       = 0;
+static uint32_t drained_v       = 0;
+static uint8_t  drained_buttons = 0;
+
+#    define SAMPLING_BARRIER() __atomic_signal_fence(__ATOMIC_SEQ_CST)
+
+/**
+ * @brief Reads the sensor once and adds its motion to the accumulator
+ *
+ * Safe to call from a timer, motion pin interrupt or dedicated thread, as long as the
+ * driver itself may be used from that context. Must not run concurrently with itself.
+ *
+ * @return true if the sensor reported any motion or button change
+ */
+bool pointing_device_sample(void) {
+#    ifdef POINTING_DEVICE_MOTION_PIN
+#        ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+    if (gpio_read_pin(POINTING_DEVICE_MOTION_PIN)) {
+        return false;
+    }
+#        else
+    if (!gpio_read_pin(POINTING_DEVICE_MOTION_PIN)) {
+        return false;
+    }
+#        endif
+#    endif
+
+    report_mouse_t sample = {.buttons = accumulator.buttons};
+    sample                = pointing_device_driver->get_report(sample);
+
+    if (!(sample.x || sample.y || sample.h || sample.v || sample.buttons != accumulator.buttons)) {
+        return false;
+    }
+
+    accumulator.sequence++;
+    SAMPLING_BARRIER();
+    accumulator.x += (uint32_t)(int32_t)sample.x;
+    accumulator.y += (uint32_t)(int32_t)sample.y;
+    accumulator.h += (uint32_t)(int32_t)sample.h;
+    accumulator.v += (uint32_t)(int32_t)sample.v;
+    accumulator.buttons = sample.buttons;
+    SAMPLING_BARRIER();
+    accumulator.sequence++;
+
+    return true;
+}
+
+static inline int32_t pointing_device_sampling_take(uint32_t total, uint32_t *drained, int32_t divisor, int32_t min, int32_t max) {
+    int32_t pending = (int32_t)(total - *drained) / divisor;
+    if (pending < min) {
+        pending = min;
+    } else if (pending > max) {
+        pending = max;
+    }
+    // Sub-count remainders and anything beyond the report range stay in the accumulator for the next report.
+    *drained += (uint32_t)(pending * divisor);
+    return pending;
+}
+
+/**
+ * @brief Moves the motion accumulated since the last drain into a mouse report
+ *
+ * Motion is divided by POINTING_DEVICE_SAMPLING_DIVISOR, and both the remainder
+ * and motion that does not fit in a single report are carried over to the next
+ * one rather than dropped. Buttons reported by the sensor replace those it
+ * reported last time, leaving any other buttons untouched.
+ *
+ * @param[in] mouse_report report_mouse_t
+ * @return report_mouse_t with accumulated motion
+ */
+report_mouse_t pointing_device_sampling_drain(report_mouse_t mouse_report) {
+    pointing_device_accumulator_t snapshot;
+    uint8_t                       sequence;
+
+    do {
+        sequence = accumulator.sequence;
+        SAMPLING_BARRIER();
+        snapshot.x       = accumulator.x;
+        snapshot.y       = accumulator.y;
+        snapshot.h       = accumulator.h;
+        snapshot.v       = accumulator.v;
+        snapshot.buttons = accumulator.buttons;
+        SAMPLING_BARRIER();
+    } while ((sequence & 1) || sequence != accumulator.sequence);
+
+    mouse_report.x       = pointing_device_sampling_take(snapshot.x, &drained_x, POINTING_DEVICE_SAMPLING_DIVISOR, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+    mouse_report.y       = pointing_device_sampling_take(snapshot.y, &drained_y, POINTING_DEVICE_SAMPLING_DIVISOR, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+    mouse_report.h       = pointing_device_sampling_take(snapshot.h, &drained_h, 1, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+    mouse_report.v       = pointing_device_sampling_take(snapshot.v, &drained_v, 1, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+    mouse_report.buttons = (mouse_report.buttons & ~drained_buttons) | snapshot.buttons;
+    drained_buttons      = snapshot.buttons;
+
+    return mouse_report;
+}
+
+/**
+ * @brief Discards any motion accumulated but not yet drained
+ */
+void pointing_device_sampling_clear(void) {
+    drained_x = accumulator.x;
+    drained_y = accumulator.y;
+    drained_h = accumulator.h;
+    drained_v = accumulator.v;
+}
+
+#    if defined(POINTING_DEVICE_SAMPLING_THREAD) && defined(PROTOCOL_CHIBIOS)
+// Serialises the sampling thread with every other use of the sensor driver, e.g. setting the CPI.
+static MUTEX_DECL(pointing_device_sampling_mutex);
+
+void pointing_device_sampling_lock(void) {
+    chMtxLock(&pointing_device_sampling_mutex);
+}
+
+void pointing_device_sampling_unlock(void) {
+    chMtxUnlock(&pointing_device_sampling_mutex);
+}
+
+static THD_WORKING_AREA(waPointingSamplingThread, 256);
+static THD_FUNCTION(PointingSamplingThread, arg) {
+    (void)arg;
+    chRegSetThreadName("pointing_sampling");
+
+    systime_t next = chVTGetSystemTimeX();
+    while (true) {
+        pointing_device_sampling_lock();
+        pointing_device_sample();
+        pointing_device_sampling_unlock();
+        next = chThdSleepUntilWindowed(next, chTimeAddX(next, TIME_US2I(POINTING_DEVICE_SAMPLING_INTERVAL_US)));
+    }
+}
+#    endif
+
+/**
+ * @brief Starts the sampling stage
+ *
+ * With POINTING_DEVICE_SAMPLING_THREAD on ChibiOS, the sensor is read from a dedicated
+ * thread every POINTING_DEVICE_SAMPLING_INTERVAL_US. Otherwise pointing_device_task()
+ * samples on every main loop iteration, independently of the report throttle.
+ */
+void pointing_device_sampling_init(void) {
+#    if defined(POINTING_DEVICE_SAMPLING_THREAD) && defined(PROTOCOL_CHIBIOS)
+    chThdCreateStatic(waPointingSamplingThread, sizeof(waPointingSamplingThread), HIGHPRIO, PointingSamplingThread, NULL);
+#    endif
+}
+
+#endif
@@ -0,0 +1,30 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "report.h"
+
+#ifdef POINTING_DEVICE_SAMPLING_ENABLE
+#    ifndef POINTING_DEVICE_SAMPLING_INTERVAL_US
+#        define POINTING_DEVICE_SAMPLING_INTERVAL_US 250
+#    endif
+#    ifndef POINTING_DEVICE_SAMPLING_DIVISOR
+#        define POINTING_DEVICE_SAMPLING_DIVISOR 1
+#    endif
+
+void           pointing_device_sampling_init(void);
+bool           pointing_device_sample(void);
+report_mouse_t pointing_device_sampling_drain(report_mouse_t mouse_report);
+void           pointing_device_sampling_clear(void);
+#endif
+
+#if defined(POINTING_DEVICE_SAMPLING_ENABLE) && defined(POINTING_DEVICE_SAMPLING_THREAD) && defined(PROTOCOL_CHIBIOS)
+void pointing_device_sampling_lock(void);
+void pointing_device_sampling_unlock(void);
+#else
+#    define pointing_device_sampling_lock()
+#    define pointing_device_sampling_unlock()
+#endif
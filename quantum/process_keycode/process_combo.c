@@ -343,6 +343,7 @@ void apply_combo(uint16_t combo_index, combo_t *combo) {
             record->keycode    = combo->keycode;
             record->event.type = COMBO_EVENT;
             record->event.key  = MAKE_KEYPOS(0, 0);
+            clear_record_keycode(record);
 
             qrecord->combo_index = combo_index;
             ACTIVATE_COMBO(combo);
@@ -352,6 +353,7 @@ void apply_combo(uint16_t combo_index, combo_t *combo) {
             // key was part of the combo but not the last one, "disable" it
             // by making it a TICK event.
             record->event.type = TICK_EVENT;
+            clear_record_keycode(record);
         }
     }
     drop_combo_from_buffer(combo_index);
@@ -24,6 +24,7 @@
 #include "quantum.h"
 #include "quantum_keycodes.h"
 #include "keymap_introspection.h"
+#include <string.h>
 
 #ifndef KEY_OVERRIDE_REPEAT_DELAY
 #    define KEY_OVERRIDE_REPEAT_DELAY 500
@@ -84,6 +85,21 @@ static uint16_t deferred_register = 0;
 // TODO: in future maybe save in EEPROM?
 static bool enabled = true;
 
+// Indices of the key overrides, sorted by trigger keycode. Overrides with the same trigger keep their order, so that the first override in the keymap still takes precedence. NULL when the overrides have not been indexed yet, or do not fit into the index buffer.
+static uint16_t *override_index          = NULL;
+static uint16_t  override_index_count    = 0;
+static uint16_t  override_index_built_at = 0; // key_override_count() when the index was built
+static bool      override_index_valid    = false;
+
+// Iterates over the overrides for up to three trigger keycodes (KC_NO, the event keycode, and the last non-mod key down) in keymap order, by merging their runs of the sorted index
+#define KEY_OVERRIDE_CANDIDATE_RUNS 3
+
+typedef struct {
+    uint16_t next[KEY_OVERRIDE_CANDIDATE_RUNS];
+    uint16_t end[KEY_OVERRIDE_CANDIDATE_RUNS];
+    uint16_t linear; // next override when iterating without index
+} key_override_candidates_t;
+
 // Forward decls
 static const key_override_t *clear_active_override(const bool allow_reregister);
 
@@ -219,6 +235,113 @@ const key_override_t *clear_active_override(const bool allow_reregister) {
     return old;
 }
 
+static uint16_t override_trigger(const uint16_t idx) {
+    return key_override_get(override_index[idx])->trigger;
+}
+
+static void build_override_index(void) {
+    override_index_valid    = true;
+    override_index_built_at = key_override_count();
+    override_index          = NULL;
+    override_index_count    = 0;
+
+    uint16_t count = 0;
+    while (count < key_override_count() && key_override_get(count) != NULL) {
+        count++;
+    }
+
+    if (count > key_override_count_raw()) {
+        // Dynamically provided overrides that do not fit, fall back to iterating all of them
+        return;
+    }
+
+    uint16_t *index = key_override_index_buffer();
+
+    // Insertion sort, which is stable and only runs once
+    for (uint16_t i = 0; i < count; i++) {
+        const uint16_t trigger = key_override_get(i)->trigger;
+        uint16_t       j       = i;
+        while (j > 0 && key_override_get(index[j - 1])->trigger > trigger) {
+            index[j] = index[j - 1];
+            j--;
+        }
+        index[j] = i;
+    }
+
+    override_index       = index;
+    override_index_count = count;
+}
+
+void key_override_invalidate_index(void) {
+    override_index_valid = false;
+}
+
+/** Returns the first position in the index at which overrides with the given trigger are found */
+static uint16_t override_index_lower_bound(const uint16_t trigger) {
+    uint16_t lo = 0;
+    uint16_t hi = override_index_count;
+    while (lo < hi) {
+        const uint16_t mid = lo + (hi - lo) / 2;
+        if (override_trigger(mid) < trigger) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static void add_candidate_run(key_override_candidates_t *candidates, const uint8_t run, const uint16_t trigger) {
+    uint16_t begin = override_index_lower_bound(trigger);
+    uint16_t end   = begin;
+    while (end < override_index_count && override_trigger(end) == trigger) {
+        end++;
+    }
+    candidates->next[run] = begin;
+    candidates->end[run]  = end;
+}
+
+/** Selects the overrides that may activate on an event for `keycode`. Any other override requires a different trigger key to be down. */
+static void init_candidates(key_override_candidates_t *candidates, const uint16_t keycode) {
+    memset(candidates, 0, sizeof(key_override_candidates_t));
+
+    if (!override_index_valid || override_index_built_at != key_override_count()) {
+        build_override_index();
+    }
+    if (override_index == NULL) {
+        return;
+    }
+
+    add_candidate_run(candidates, 0, KC_NO);
+    if (keycode != KC_NO) {
+        add_candidate_run(candidates, 1, keycode);
+    }
+    if (last_key_down != KC_NO && last_key_down != keycode) {
+        add_candidate_run(candidates, 2, last_key_down);
+    }
+}
+
+/** Returns the next candidate override in keymap order, or NULL if there are none left */
+static const key_override_t *next_candidate(key_override_candidates_t *candidates) {
+    if (override_index == NULL) {
+        if (candidates->linear >= key_override_count()) {
+            return NULL;
+        }
+        return key_override_get(candidates->linear++);
+    }
+
+    int8_t best = -1;
+    for (uint8_t run = 0; run < KEY_OVERRIDE_CANDIDATE_RUNS; run++) {
+        if (candidates->next[run] < candidates->end[run] && (best < 0 || override_index[candidates->next[run]] < override_index[candidates->next[best]])) {
+            best = run;
+        }
+    }
+    if (best < 0) {
+        return NULL;
+    }
+    return key_override_get(override_index[candidates->next[best]++]);
+}
+
 /** Checks if the key event is an allowed activation event for the provided override. Does not check things like whether the correct mods or correct trigger key is down. */
 static bool check_activation_event(const key_override_t *override, const bool key_down, const bool is_mod) {
     ko_option_t options = override->options;
@@ -243,19 +366,19 @@ static bool check_activation_event(const key_override_t *override, const bool ke
     }
 }
 
-/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
+/** Iterates through the candidate key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
 static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
+    *activated = false;
+
     if (key_override_count() == 0) {
         return true;
     }
 
-    for (uint8_t i = 0; i < key_override_count(); i++) {
-        const key_override_t *const override = key_override_get(i);
+    key_override_candidates_t candidates;
+    init_candidates(&candidates, keycode);
 
-        // End of array
-        if (override == NULL) {
-            break;
-        }
+    const key_override_t *override;
+    while ((override = next_candidate(&candidates)) != NULL) {
 
         // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
         if (active_mods == 0 && override->trigger_mods != 0) {
@@ -405,7 +528,7 @@ void key_override_task(void) {
     }
 }
 
-bool process_key_override(const uint16_t keycode, const keyrecord_t *const record) {
+bool process_key_override(uint16_t keycode, keyrecord_t *record) {
 #ifdef BENCH_KEY_OVERRIDE
     uint16_t start = timer_read();
 #endif
@@ -99,8 +99,11 @@ void key_override_toggle(void);
 /** Returns whether key overrides are enabled */
 bool key_override_is_enabled(void);
 
+/** Rebuilds the key override index before the next key event. Call this after changing the triggers of the overrides returned by key_override_get(). */
+void key_override_invalidate_index(void);
+
 /** Handling of key overrides and its implemented keycodes */
-bool process_key_override(const uint16_t keycode, const keyrecord_t *const record);
+bool process_key_override(uint16_t keycode, keyrecord_t *record);
 
 /** Perform any deferred keys */
 void key_override_task(void);
@@ -242,16 +242,38 @@ void soft_reset_keyboard(void) {
     mcu_reset();
 }
 
-/* Convert record into usable keycode via the contained event. */
+/* Convert record into usable keycode via the contained event. action_exec()
+ * resolves the keycode of every key event once, with resolve_record_keycode(),
+ * and later lookups return that result; use clear_record_keycode() whenever the
+ * keycode needs to be resolved again.
+ */
 uint16_t get_record_keycode(keyrecord_t *record, bool update_layer_cache) {
 #if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
     if (record->keycode) {
         return record->keycode;
     }
 #endif
+    if (record->keycode_resolved) {
+        return record->resolved_keycode;
+    }
     return get_event_keycode(record->event, update_layer_cache);
 }
 
+/* Resolve the keycode of the record against the current layer state, updating
+ * the source layers cache, and memoise it. */
+uint16_t resolve_record_keycode(keyrecord_t *record) {
+    record->keycode_resolved = false;
+    record->resolved_keycode = get_record_keycode(record, true);
+    record->keycode_resolved = true;
+    return record->resolved_keycode;
+}
+
+/* Forget the memoised keycode of the record, e.g. after its event was rewritten
+ * or the layer state changed before it is processed. */
+void clear_record_keycode(keyrecord_t *record) {
+    record->keycode_resolved = false;
+}
+
 /* Convert event into usable keycode. Checks the layer cache to ensure that it
  * retains the correct keycode after a layer change, if the key is still pressed.
  * "update_layer_cache" is to ensure that it only updates the layer cache when
@@ -292,156 +314,196 @@ void post_process_record_quantum(keyrecord_t *record) {
     post_process_record_kb(keycode, record);
 }
 
-/* Core keycode function, hands off handling to other functions,
-    then processes internal quantum keycodes, and then processes
-    ACTIONs.                                                      */
-bool process_record_quantum(keyrecord_t *record) {
-    uint16_t keycode = get_record_keycode(record, true);
-
-    // This is how you use actions here
-    // if (keycode == QK_LEADER) {
-    //   action_t action;
-    //   action.code = ACTION_DEFAULT_LAYER_SET(0);
-    //   process_action(record, action);
-    //   return false;
-    // }
-
-#if defined(SECURE_ENABLE)
-    if (!preprocess_secure(keycode, record)) {
-        return false;
-    }
-#endif
-
-#ifdef TAP_DANCE_ENABLE
-    if (preprocess_tap_dance(keycode, record)) {
-        // The tap dance might have updated the layer state, therefore the
-        // result of the keycode lookup might change.
-        keycode = get_record_keycode(record, true);
-    }
-#endif
-
-#ifdef RGBLIGHT_ENABLE
-    if (record->event.pressed) {
-        preprocess_rgblight();
-    }
-#endif
+/** \brief A keycode processor, along with the range of keycodes it acts upon.
+ *
+ * Processors that only act upon their own keycodes are skipped for any other
+ * keycode. Only processors that need to observe every key (recording, feedback,
+ * modes capturing ordinary keys, or state cleared by any other key) cover the
+ * full range.
+ */
+typedef struct {
+    bool (*process)(uint16_t keycode, keyrecord_t *record);
+    uint16_t first;
+    uint16_t last;
+} keycode_processor_t;
 
-#ifdef WPM_ENABLE
-    if (record->event.pressed) {
-        update_wpm(keycode);
-    }
-#endif
+#define PROCESS_ALL_KEYCODES(fn) {fn, 0x0000, 0xFFFF}
+#define PROCESS_KEYCODES(fn, first, last) {fn, first, last}
 
-    if (!(
-#if defined(KEY_LOCK_ENABLE)
-            // Must run first to be able to mask key_up events.
-            process_key_lock(&keycode, record) &&
-#endif
+/** \brief The keycode processors run by process_record_quantum, in order. */
+static const keycode_processor_t keycode_processors[] PROGMEM = {
 #if defined(DYNAMIC_MACRO_ENABLE) && !defined(DYNAMIC_MACRO_USER_CALL)
-            // Must run asap to ensure all keypresses are recorded.
-            process_dynamic_macro(keycode, record) &&
+    // Must run asap to ensure all keypresses are recorded.
+    PROCESS_ALL_KEYCODES(process_dynamic_macro),
 #endif
 #ifdef REPEAT_KEY_ENABLE
-            process_last_key(keycode, record) && process_repeat_key(keycode, record) &&
+    PROCESS_ALL_KEYCODES(process_last_key),
+    PROCESS_ALL_KEYCODES(process_repeat_key),
 #endif
 #if defined(AUDIO_ENABLE) && defined(AUDIO_CLICKY)
-            process_clicky(keycode, record) &&
+    PROCESS_ALL_KEYCODES(process_clicky),
 #endif
 #ifdef HAPTIC_ENABLE
-            process_haptic(keycode, record) &&
+    PROCESS_ALL_KEYCODES(process_haptic),
 #endif
 #if defined(POINTING_DEVICE_ENABLE) && defined(POINTING_DEVICE_AUTO_MOUSE_ENABLE)
-            process_auto_mouse(keycode, record) &&
+    PROCESS_ALL_KEYCODES(process_auto_mouse),
 #endif
-            process_record_modules(keycode, record) && // modules must run before kb
-            process_record_kb(keycode, record) &&
+    PROCESS_ALL_KEYCODES(process_record_modules), // modules must run before kb
+    PROCESS_ALL_KEYCODES(process_record_kb),
 #if defined(VIA_ENABLE)
-            process_record_via(keycode, record) &&
+    PROCESS_KEYCODES(process_record_via, QK_MACRO, QK_MACRO_MAX),
 #endif
 #if defined(SECURE_ENABLE)
-            process_secure(keycode, record) &&
+    PROCESS_KEYCODES(process_secure, QK_SECURE_LOCK, QK_SECURE_REQUEST),
 #endif
 #if defined(SEQUENCER_ENABLE)
-            process_sequencer(keycode, record) &&
+    PROCESS_KEYCODES(process_sequencer, QK_SEQUENCER, QK_SEQUENCER_MAX),
 #endif
 #if defined(MIDI_ENABLE) && defined(MIDI_ADVANCED)
-            process_midi(keycode, record) &&
+    PROCESS_KEYCODES(process_midi, QK_MIDI, QK_MIDI_MAX),
 #endif
 #ifdef AUDIO_ENABLE
-            process_audio(keycode, record) &&
+    PROCESS_KEYCODES(process_audio, QK_AUDIO, QK_AUDIO_MAX),
 #endif
 #if defined(BACKLIGHT_ENABLE)
-            process_backlight(keycode, record) &&
+    PROCESS_KEYCODES(process_backlight, QK_BACKLIGHT_ON, QK_BACKLIGHT_TOGGLE_BREATHING),
 #endif
 #if defined(LED_MATRIX_ENABLE)
-            process_led_matrix(keycode, record) &&
+    // also handles the backlight keycodes
+    PROCESS_KEYCODES(process_led_matrix, QK_BACKLIGHT_ON, QK_LED_MATRIX_SPEED_DOWN),
 #endif
 #ifdef STENO_ENABLE
-            process_steno(keycode, record) &&
+    PROCESS_KEYCODES(process_steno, QK_STENO, QK_STENO_MAX),
 #endif
 #if (defined(AUDIO_ENABLE) || (defined(MIDI_ENABLE) && defined(MIDI_BASIC))) && !defined(NO_MUSIC_MODE)
-            process_music(keycode, record) &&
+    PROCESS_ALL_KEYCODES(process_music),
 #endif
 #ifdef CAPS_WORD_ENABLE
-            process_caps_word(keycode, record) &&
+    PROCESS_ALL_KEYCODES(process_caps_word),
 #endif
 #ifdef KEY_OVERRIDE_ENABLE
-            process_key_override(keycode, record) &&
+    PROCESS_ALL_KEYCODES(process_key_override),
 #endif
 #ifdef TAP_DANCE_ENABLE
-            process_tap_dance(keycode, record) &&
+    PROCESS_ALL_KEYCODES(process_tap_dance),
 #endif
 #if defined(UNICODE_COMMON_ENABLE)
-            process_unicode_common(keycode, record) &&
+#    if defined(UCIS_ENABLE)
+    // UCIS input captures all keys while active
+    PROCESS_ALL_KEYCODES(process_unicode_common),
+#    else
+    PROCESS_KEYCODES(process_unicode_common, QK_UNICODE_MODE_NEXT, QK_UNICODE_MODE_EMACS),
+    PROCESS_KEYCODES(process_unicode_common, QK_UNICODE, QK_UNICODE_MAX),
+#    endif
 #endif
 #ifdef LEADER_ENABLE
-            process_leader(keycode, record) &&
+    PROCESS_ALL_KEYCODES(process_leader),
 #endif
 #ifdef AUTO_SHIFT_ENABLE
-            process_auto_shift(keycode, record) &&
+    PROCESS_ALL_KEYCODES(process_auto_shift),
 #endif
 #ifdef DYNAMIC_TAPPING_TERM_ENABLE
-            process_dynamic_tapping_term(keycode, record) &&
+    PROCESS_KEYCODES(process_dynamic_tapping_term, QK_DYNAMIC_TAPPING_TERM_PRINT, QK_DYNAMIC_TAPPING_TERM_DOWN),
 #endif
 #ifdef SPACE_CADET_ENABLE
-            process_space_cadet(keycode, record) &&
+    PROCESS_ALL_KEYCODES(process_space_cadet),
 #endif
 #ifdef MAGIC_ENABLE
-            process_magic(keycode, record) &&
+    PROCESS_KEYCODES(process_magic, QK_MAGIC, QK_MAGIC_MAX),
 #endif
 #ifdef GRAVE_ESC_ENABLE
-            process_grave_esc(keycode, record) &&
+    PROCESS_KEYCODES(process_grave_esc, QK_GRAVE_ESCAPE, QK_GRAVE_ESCAPE),
 #endif
 #if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
-            process_underglow(keycode, record) &&
+    PROCESS_KEYCODES(process_underglow, QK_UNDERGLOW_TOGGLE, QK_UNDERGLOW_SPEED_DOWN),
 #endif
 #if defined(RGB_MATRIX_ENABLE)
-            process_rgb_matrix(keycode, record) &&
+    PROCESS_KEYCODES(process_rgb_matrix, QK_RGB_MATRIX_ON, QK_RGB_MATRIX_SPEED_DOWN),
 #endif
 #ifdef JOYSTICK_ENABLE
-            process_joystick(keycode, record) &&
+    PROCESS_KEYCODES(process_joystick, QK_JOYSTICK, QK_JOYSTICK_MAX),
 #endif
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
-            process_programmable_button(keycode, record) &&
+    PROCESS_KEYCODES(process_programmable_button, QK_PROGRAMMABLE_BUTTON, QK_PROGRAMMABLE_BUTTON_MAX),
 #endif
 #ifdef AUTOCORRECT_ENABLE
-            process_autocorrect(keycode, record) &&
+    PROCESS_ALL_KEYCODES(process_autocorrect),
 #endif
 #ifdef TRI_LAYER_ENABLE
-            process_tri_layer(keycode, record) &&
+    PROCESS_KEYCODES(process_tri_layer, QK_TRI_LAYER_LOWER, QK_TRI_LAYER_UPPER),
 #endif
 #if !defined(NO_ACTION_LAYER)
-            process_default_layer(keycode, record) &&
+    PROCESS_KEYCODES(process_default_layer, QK_PERSISTENT_DEF_LAYER, QK_PERSISTENT_DEF_LAYER_MAX),
 #endif
 #ifdef LAYER_LOCK_ENABLE
-            process_layer_lock(keycode, record) &&
+    PROCESS_ALL_KEYCODES(process_layer_lock),
 #endif
 #ifdef CONNECTION_ENABLE
-            process_connection(keycode, record) &&
+    PROCESS_KEYCODES(process_connection, QK_CONNECTION, QK_CONNECTION_MAX),
+#endif
+};
+
+/* Core keycode function, hands off handling to other functions,
+    then processes internal quantum keycodes, and then processes
+    ACTIONs.                                                      */
+bool process_record_quantum(keyrecord_t *record) {
+    if (!record->keycode_resolved) {
+        // a record taken from the tapping waiting buffer, or not from action_exec()
+        resolve_record_keycode(record);
+    }
+    uint16_t keycode = get_record_keycode(record, true);
+
+    // This is how you use actions here
+    // if (keycode == QK_LEADER) {
+    //   action_t action;
+    //   action.code = ACTION_DEFAULT_LAYER_SET(0);
+    //   process_action(record, action);
+    //   return false;
+    // }
+
+#if defined(SECURE_ENABLE)
+    if (!preprocess_secure(keycode, record)) {
+        return false;
+    }
+#endif
+
+#ifdef TAP_DANCE_ENABLE
+    if (preprocess_tap_dance(keycode, record)) {
+        // The tap dance might have updated the layer state, therefore the
+        // result of the keycode lookup might change.
+        keycode = resolve_record_keycode(record);
+    }
+#endif
+
+#ifdef RGBLIGHT_ENABLE
+    if (record->event.pressed) {
+        preprocess_rgblight();
+    }
+#endif
+
+#ifdef WPM_ENABLE
+    if (record->event.pressed) {
+        update_wpm(keycode);
+    }
 #endif
-            true)) {
+
+#if defined(KEY_LOCK_ENABLE)
+    // Must run first to be able to mask key_up events.
+    if (!process_key_lock(&keycode, record)) {
         return false;
     }
+#endif
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(keycode_processors); i++) {
+        if (keycode < pgm_read_word(&keycode_processors[i].first) || keycode > pgm_read_word(&keycode_processors[i].last)) {
+            continue;
+        }
+        bool (*process)(uint16_t, keyrecord_t *) = pgm_read_ptr(&keycode_processors[i].process);
+        if (!process(keycode, record)) {
+            return false;
+        }
+    }
 
     if (record->event.pressed) {
         switch (keycode) {
@@ -241,6 +241,10 @@ extern layer_state_t layer_state;
 #    include "os_detection.h"
 #endif
 
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+
 #ifdef LAYER_LOCK_ENABLE
 #    include "layer_lock.h"
 #endif
@@ -259,6 +263,7 @@ void set_single_persistent_default_layer(uint8_t default_layer);
 #define IS_LAYER_OFF_STATE(state, layer) !layer_state_cmp(state, layer)
 
 uint16_t get_record_keycode(keyrecord_t *record, bool update_layer_cache);
+void     clear_record_keycode(keyrecord_t *record);
 uint16_t get_event_keycode(keyevent_t event, bool update_layer_cache);
 bool     pre_process_record_quantum(keyrecord_t *record);
 bool     pre_process_record_kb(uint16_t keycode, keyrecord_t *record);
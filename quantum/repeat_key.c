@@ -90,6 +90,7 @@ void repeat_key_invoke(const keyevent_t* event) {
 
     // Generate a keyrecord and plumb it into the event pipeline.
     registered_record.event = *event;
+    clear_record_keycode(&registered_record);
     processing_repeat_count = registered_repeat_count;
     process_record(&registered_record);
     processing_repeat_count = 0;
@@ -271,6 +272,7 @@ void alt_repeat_key_invoke(const keyevent_t* event) {
 
     // Generate a keyrecord and plumb it into the event pipeline.
     registered_record.event = *event;
+    clear_record_keycode(&registered_record);
     processing_repeat_count = registered_repeat_count;
     process_record(&registered_record);
     processing_repeat_count = 0;
@@ -0,0 +1,17 @@
+#pragma once
+
+typedef hsv_t (*angle_dist_f)(hsv_t hsv, uint8_t angle, uint8_t dist, uint8_t time);
+
+RGB_MATRIX_RUNNER bool effect_runner_angle_dist(effect_params_t* params, angle_dist_f effect_func) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+
+    rgb_matrix_hsv_batch_t batch = {0};
+    uint8_t time = scale16by8(g_rgb_timer, rgb_matrix_config.speed / 2);
+    RGB_MATRIX_FOREACH_LED(i, led_min, led_max) {
+        uint8_t angle = RGB_MATRIX_LED_ANGLE(i);
+        uint8_t dist  = RGB_MATRIX_LED_DIST(i);
+        rgb_matrix_hsv_batch_set(&batch, i, effect_func(rgb_matrix_config.hsv, angle, dist, time));
+    }
+    rgb_matrix_hsv_batch_flush(&batch);
+    return rgb_matrix_check_finished_leds(led_max);
+}
@@ -20,6 +20,32 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
 #        ifdef RGB_MATRIX_TYPING_HEATMAP_SLIM
     // Limit effect to pressed keys
     g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+#        elif defined(RGB_MATRIX_LED_GEOMETRY) && RGB_MATRIX_TYPING_HEATMAP_SPREAD <= RGB_MATRIX_LED_NEIGHBOUR_RADIUS
+    uint8_t led = g_led_config.matrix_co[row][col];
+    if (led == NO_LED) { // skip as pressed key doesn't have an led position
+        return;
+    }
+    g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+
+    // neighbours are sorted by distance, so stop at the first one out of reach
+    uint16_t end = pgm_read_word(&g_led_neighbours_offset[led + 1]);
+    for (uint16_t n = pgm_read_word(&g_led_neighbours_offset[led]); n < end; n++) {
+        uint8_t distance = pgm_read_byte(&g_led_neighbours[n].dist);
+        if (distance > RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+            break;
+        }
+        uint8_t i_led = pgm_read_byte(&g_led_neighbours[n].led);
+        uint8_t i_row = pgm_read_byte(&g_led_key[i_led].row);
+        uint8_t i_col = pgm_read_byte(&g_led_key[i_led].col);
+        if (i_row == NO_LED) { // skip as target led doesn't have a key
+            continue;
+        }
+        uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
+        if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
+            amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
+        }
+        g_rgb_frame_buffer[i_row][i_col] = qadd8(g_rgb_frame_buffer[i_row][i_col], amount);
+    }
 #        else
     if (g_led_config.matrix_co[row][col] == NO_LED) { // skip as pressed key doesn't have an led position
         return;
@@ -62,7 +88,7 @@ bool TYPING_HEATMAP(effect_params_t* params) {
     }
 
     // The heatmap animation might run in several iterations depending on
-    // `RGB_MATRIX_LED_PROCESS_LIMIT`, therefore we only want to update the
+    // `RGB_MATRIX_LED_PROCESS_LIMIT` or `RGB_MATRIX_RENDER_BUDGET_US`, therefore we only want to update the
     // timer when the animation starts.
     if (params->iter == 0) {
         decrease_heatmap_values = timer_elapsed(heatmap_decrease_timer) >= RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS;
@@ -74,9 +100,26 @@ bool TYPING_HEATMAP(effect_params_t* params) {
     }
 
     // Render heatmap & decrease
+#        ifdef RGB_MATRIX_LED_GEOMETRY
+    for (uint8_t i = led_min; i < led_max; i++) {
+        uint8_t row = pgm_read_byte(&g_led_key[i].row);
+        uint8_t col = pgm_read_byte(&g_led_key[i].col);
+        if (row == NO_LED) continue;
+        uint8_t val = g_rgb_frame_buffer[row][col];
+        if (!HAS_ANY_FLAGS(g_led_config.flags[i], params->flags)) continue;
+
+        hsv_t hsv = {170 - qsub8(val, 85), rgb_matrix_config.hsv.s, scale8((qadd8(170, val) - 170) * 3, rgb_matrix_config.hsv.v)};
+        rgb_t rgb = rgb_matrix_hsv_to_rgb(hsv);
+        rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+
+        if (decrease_heatmap_values) {
+            g_rgb_frame_buffer[row][col] = qsub8(val, 1);
+        }
+    }
+#        else
     uint8_t count = 0;
-    for (uint8_t row = 0; row < MATRIX_ROWS && count < RGB_MATRIX_LED_PROCESS_LIMIT; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS && RGB_MATRIX_LED_PROCESS_LIMIT; col++) {
+    for (uint8_t row = 0; row < MATRIX_ROWS && count < led_max - led_min; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS && count < led_max - led_min; col++) {
             if (g_led_config.matrix_co[row][col] >= led_min && g_led_config.matrix_co[row][col] < led_max) {
                 count++;
                 uint8_t val = g_rgb_frame_buffer[row][col];
@@ -92,6 +135,7 @@ bool TYPING_HEATMAP(effect_params_t* params) {
             }
         }
     }
+#        endif
 
     return rgb_matrix_check_finished_leds(led_max);
 }
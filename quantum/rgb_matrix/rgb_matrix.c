@@ -28,6 +28,32 @@
 
 #include <lib/lib8tion/lib8tion.h>
 
+#ifdef RGB_MATRIX_RENDER_STATS
+#    include "timer.h"
+#    if defined(PROTOCOL_CHIBIOS)
+#        include <ch.h>
+#        include <hal.h>
+#        if !defined(RGB_MATRIX_RENDER_TICKS_PER_US) && defined(STM32_SYSCLK)
+#            define RGB_MATRIX_RENDER_TICKS_PER_US (STM32_SYSCLK / 1000000)
+#        endif
+#    endif
+
+#    if defined(PROTOCOL_CHIBIOS) && (PORT_SUPPORTS_RT == TRUE) && defined(RGB_MATRIX_RENDER_TICKS_PER_US)
+// cycle counter (DWT on ARMv7-M)
+#        define RGB_MATRIX_RENDER_CYCLE_COUNTER
+#        define RGB_MATRIX_RENDER_TIMESTAMP() chSysGetRealtimeCounterX()
+#        define RGB_MATRIX_RENDER_TICKS_TO_US(ticks) ((ticks) / RGB_MATRIX_RENDER_TICKS_PER_US)
+#    else
+// millisecond timer, the statistics average out over many task runs, but it is too coarse to size render slices
+#        define RGB_MATRIX_RENDER_TIMESTAMP() timer_read32()
+#        define RGB_MATRIX_RENDER_TICKS_TO_US(ticks) ((ticks) * 1000)
+#    endif
+
+#    ifndef RGB_MATRIX_RENDER_STATS_INTERVAL
+#        define RGB_MATRIX_RENDER_STATS_INTERVAL 1000
+#    endif
+#endif // RGB_MATRIX_RENDER_STATS
+
 #ifndef RGB_MATRIX_CENTER
 const led_point_t k_rgb_matrix_center = {112, 32};
 #else
@@ -38,6 +64,10 @@ __attribute__((weak)) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
     return hsv_to_rgb(hsv);
 }
 
+__attribute__((weak)) void rgb_matrix_hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+    hsv_to_rgb_batch(hsv, rgb, count, rgb_matrix_hsv_to_rgb);
+}
+
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
 
@@ -70,6 +100,7 @@ uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #endif // RGB_MATRIX_FRAMEBUFFER_EFFECTS
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
+uint8_t    g_last_hit_led[RGB_MATRIX_LED_COUNT];
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
 // internals
@@ -79,10 +110,27 @@ static uint8_t         rgb_last_effect   = UINT8_MAX;
 static effect_params_t rgb_effect_params = {0, LED_FLAG_ALL, false};
 static rgb_task_states rgb_task_state    = SYNCING;
 
+#ifdef RGB_MATRIX_RENDER_STATS
+static rgb_matrix_render_stats_t rgb_render_stats           = {UINT8_MAX, 0, 0, 0, 0};
+static uint32_t                  rgb_render_frame_us        = 0; // frame in progress
+static uint32_t                  rgb_render_interval_us     = 0; // finished frames of the current interval
+static uint32_t                  rgb_render_interval_max_us = 0;
+static uint16_t                  rgb_render_interval_frames = 0;
+static uint16_t                  rgb_render_interval_start  = 0;
+#endif // RGB_MATRIX_RENDER_STATS
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+static struct rgb_matrix_limits_t rgb_render_slice       = {0, 0};
+static uint8_t                    rgb_render_slice_iter  = 0;
+static uint16_t                   rgb_render_led_cost    = 0; // microseconds per LED, in 1/16ths
+static bool                       rgb_render_cost_sample = false;
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
 // double buffers
 static uint32_t rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+// ring buffer, the oldest hit is at last_hit_head
 static last_hit_t last_hit_buffer;
+static uint8_t    last_hit_head = 0;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
 // split rgb matrix
@@ -167,6 +215,26 @@ void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 #endif
 }
 
+#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+// Position in last_hit_buffer of the n-th oldest hit
+static uint8_t last_hit_position(uint8_t n) {
+    uint16_t position = last_hit_head + n;
+    return position < LED_HITS_TO_REMEMBER ? position : position - LED_HITS_TO_REMEMBER;
+}
+
+static void last_hit_drop_oldest(void) {
+    last_hit_head = last_hit_position(1);
+    last_hit_buffer.count--;
+}
+
+static void last_hit_expire(void) {
+    // Ticks only ever grow, so the oldest hits expire first
+    while (last_hit_buffer.count > 0 && scale16by8(last_hit_buffer.tick[last_hit_head], qadd8(rgb_matrix_config.speed, 1)) >= LED_HITS_EXPIRY) {
+        last_hit_drop_oldest();
+    }
+}
+#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+
 void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
 #ifndef RGB_MATRIX_SPLIT
     if (!is_keyboard_master()) return;
@@ -185,16 +253,12 @@ void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
         led_count = rgb_matrix_map_row_column_to_led(row, col, led);
     }
 
-    if (last_hit_buffer.count + led_count > LED_HITS_TO_REMEMBER) {
-        memcpy(&last_hit_buffer.x[0], &last_hit_buffer.x[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.y[0], &last_hit_buffer.y[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.tick[0], &last_hit_buffer.tick[led_count], (LED_HITS_TO_REMEMBER - led_count) * 2); // 16 bit
-        memcpy(&last_hit_buffer.index[0], &last_hit_buffer.index[led_count], LED_HITS_TO_REMEMBER - led_count);
-        last_hit_buffer.count = LED_HITS_TO_REMEMBER - led_count;
-    }
-
+    last_hit_expire();
     for (uint8_t i = 0; i < led_count; i++) {
-        uint8_t index                = last_hit_buffer.count;
+        if (last_hit_buffer.count == LED_HITS_TO_REMEMBER) {
+            last_hit_drop_oldest();
+        }
+        uint8_t index                = last_hit_position(last_hit_buffer.count);
         last_hit_buffer.x[index]     = g_led_config.point[led[i]].x;
         last_hit_buffer.y[index]     = g_led_config.point[led[i]].y;
         last_hit_buffer.index[index] = led[i];
@@ -258,14 +322,13 @@ static void rgb_task_timers(void) {
 
     // Update double buffer last hit timers
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
-    uint8_t count = last_hit_buffer.count;
-    for (uint8_t i = 0; i < count; ++i) {
-        if (UINT16_MAX - deltaTime < last_hit_buffer.tick[i]) {
-            last_hit_buffer.count--;
-            continue;
-        }
-        last_hit_buffer.tick[i] += deltaTime;
+    while (last_hit_buffer.count > 0 && UINT16_MAX - deltaTime < last_hit_buffer.tick[last_hit_head]) {
+        last_hit_drop_oldest();
+    }
+    for (uint8_t i = 0; i < last_hit_buffer.count; ++i) {
+        last_hit_buffer.tick[last_hit_position(i)] += deltaTime;
     }
+    last_hit_expire();
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 }
 
@@ -282,20 +345,135 @@ static void rgb_task_start(void) {
     // update double buffers
     g_rgb_timer = rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
-    g_last_hit_tracker = last_hit_buffer;
+    g_last_hit_tracker.count = last_hit_buffer.count;
+    memset(g_last_hit_led, UINT8_MAX, sizeof(g_last_hit_led));
+    for (uint8_t i = 0; i < last_hit_buffer.count; ++i) {
+        uint8_t position            = last_hit_position(i);
+        g_last_hit_tracker.x[i]     = last_hit_buffer.x[position];
+        g_last_hit_tracker.y[i]     = last_hit_buffer.y[position];
+        g_last_hit_tracker.index[i] = last_hit_buffer.index[position];
+        g_last_hit_tracker.tick[i]  = last_hit_buffer.tick[position];
+
+        g_last_hit_led[g_last_hit_tracker.index[i]] = i;
+    }
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
     // next task
     rgb_task_state = RENDERING;
 }
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+// Picks the LEDs the next task run renders, continuing where the previous slice ended.
+// The slice is sized so the measured cost per LED fits RGB_MATRIX_RENDER_BUDGET_US.
+static void rgb_render_next_slice(void) {
+    uint8_t start = 0;
+    uint8_t end   = RGB_MATRIX_LED_COUNT;
+#    if defined(RGB_MATRIX_SPLIT)
+    if (is_keyboard_left()) {
+        end = k_rgb_matrix_split[0];
+    } else {
+        start = k_rgb_matrix_split[0];
+    }
+#    endif
+    if (rgb_effect_params.iter > 0) {
+        start = rgb_render_slice.led_max_index < end ? rgb_render_slice.led_max_index : end;
+    }
+
+    uint16_t size = RGB_MATRIX_LED_PROCESS_LIMIT;
+#    ifdef RGB_MATRIX_RENDER_CYCLE_COUNTER
+    // without a measured cost, e.g. when slices are too quick to measure, stick to the fixed limit
+    if (rgb_render_cost_sample && rgb_render_led_cost > 0) {
+        size = ((uint32_t)RGB_MATRIX_RENDER_BUDGET_US << 4) / rgb_render_led_cost;
+    }
+#    endif
+    if (size < 1) size = 1;
+    if (size > end - start) size = end - start;
+
+    rgb_render_slice_iter          = rgb_effect_params.iter;
+    rgb_render_slice.led_min_index = start;
+    rgb_render_slice.led_max_index = start + size;
+}
+
+static void rgb_render_update_cost(uint32_t us) {
+    uint8_t leds = rgb_render_slice.led_max_index - rgb_render_slice.led_min_index;
+    // initialising an effect is a one-off, it says little about the following frames
+    if (leds == 0 || rgb_effect_params.init) {
+        return;
+    }
+
+    uint32_t cost = (us << 4) / leds;
+    if (cost > UINT16_MAX) cost = UINT16_MAX;
+    if (rgb_render_cost_sample) {
+        // moving average, so a single slow task run does not collapse the slice size
+        cost = (3 * (uint32_t)rgb_render_led_cost + cost) / 4;
+    }
+    rgb_render_led_cost    = cost;
+    rgb_render_cost_sample = true;
+}
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
+#ifdef RGB_MATRIX_RENDER_STATS
+static void rgb_render_measure(uint8_t effect, uint32_t us) {
+    if (effect != rgb_render_stats.effect) {
+        rgb_render_stats           = (rgb_matrix_render_stats_t){effect, 0, 0, 0, 0};
+        rgb_render_frame_us        = 0;
+        rgb_render_interval_us     = 0;
+        rgb_render_interval_max_us = 0;
+        rgb_render_interval_frames = 0;
+        rgb_render_interval_start  = timer_read();
+#    ifdef RGB_MATRIX_RENDER_BUDGET_US
+        rgb_render_led_cost    = 0;
+        rgb_render_cost_sample = false;
+#    endif
+    }
+
+#    ifdef RGB_MATRIX_RENDER_BUDGET_US
+    rgb_render_update_cost(us);
+    rgb_render_stats.slice_size = rgb_render_slice.led_max_index - rgb_render_slice.led_min_index;
+#    endif
+
+    rgb_render_frame_us += us;
+    if (us > rgb_render_interval_max_us) {
+        rgb_render_interval_max_us = us;
+    }
+    if (rgb_task_state != FLUSHING) {
+        return;
+    }
+
+    rgb_render_interval_us += rgb_render_frame_us;
+    rgb_render_interval_frames++;
+    rgb_render_frame_us = 0;
+
+    uint16_t elapsed = timer_elapsed(rgb_render_interval_start);
+    if (elapsed >= RGB_MATRIX_RENDER_STATS_INTERVAL) {
+        rgb_render_stats.fps                = (uint32_t)rgb_render_interval_frames * 1000 / elapsed;
+        rgb_render_stats.render_time_us     = rgb_render_interval_us / rgb_render_interval_frames;
+        rgb_render_stats.render_time_max_us = rgb_render_interval_max_us;
+        rgb_render_interval_us              = 0;
+        rgb_render_interval_max_us          = 0;
+        rgb_render_interval_frames          = 0;
+        rgb_render_interval_start           = timer_read();
+    }
+}
+
+rgb_matrix_render_stats_t rgb_matrix_get_render_stats(void) {
+    return rgb_render_stats;
+}
+#endif // RGB_MATRIX_RENDER_STATS
+
 static void rgb_task_render(uint8_t effect) {
     bool rendering         = false;
     rgb_effect_params.init = (effect != rgb_last_effect) || (rgb_matrix_config.enable != rgb_last_enable);
     if (rgb_effect_params.flags != rgb_matrix_config.flags) {
         rgb_effect_params.flags = rgb_matrix_config.flags;
+#ifdef RGB_MATRIX_INLINE_EFFECT_RUNNERS
+        rgb_matrix_update_flag_leds(rgb_effect_params.flags);
+#endif
         rgb_matrix_set_color_all(0, 0, 0);
     }
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    rgb_render_next_slice();
+#endif
 
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
@@ -387,7 +565,10 @@ void rgb_matrix_task(void) {
         case STARTING:
             rgb_task_start();
             break;
-        case RENDERING:
+        case RENDERING: {
+#ifdef RGB_MATRIX_RENDER_STATS
+            uint32_t render_start = RGB_MATRIX_RENDER_TIMESTAMP();
+#endif
             rgb_task_render(effect);
             if (effect) {
                 if (rgb_task_state == FLUSHING) { // ensure we only draw basic indicators once rendering is finished
@@ -395,7 +576,10 @@ void rgb_matrix_task(void) {
                 }
                 rgb_matrix_indicators_advanced(&rgb_effect_params);
             }
-            break;
+#ifdef RGB_MATRIX_RENDER_STATS
+            rgb_render_measure(effect, RGB_MATRIX_RENDER_TICKS_TO_US(RGB_MATRIX_RENDER_TIMESTAMP() - render_start));
+#endif
+        } break;
         case FLUSHING:
             rgb_task_flush(effect);
             break;
@@ -423,6 +607,11 @@ __attribute__((weak)) bool rgb_matrix_indicators_user(void) {
 }
 
 struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter) {
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    if (iter == rgb_render_slice_iter) {
+        return rgb_render_slice;
+    }
+#endif
     struct rgb_matrix_limits_t limits = {0};
 #if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
 #    if defined(RGB_MATRIX_SPLIT)
@@ -483,9 +672,11 @@ void rgb_matrix_init(void) {
     }
 
     last_hit_buffer.count = 0;
+    last_hit_head         = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
         last_hit_buffer.tick[i] = UINT16_MAX;
     }
+    memset(g_last_hit_led, UINT8_MAX, sizeof(g_last_hit_led));
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
     eeconfig_init_rgb_matrix();
@@ -494,6 +685,10 @@ void rgb_matrix_init(void) {
         eeconfig_update_rgb_matrix_default();
     }
     eeconfig_debug_rgb_matrix(); // display current eeprom values
+
+#ifdef RGB_MATRIX_INLINE_EFFECT_RUNNERS
+    rgb_matrix_update_flag_leds(rgb_effect_params.flags);
+#endif
 }
 
 void rgb_matrix_set_suspend_state(bool state) {
@@ -723,6 +918,10 @@ void rgb_matrix_decrease_speed(void) {
 
 void rgb_matrix_set_flags_eeprom_helper(led_flags_t flags, bool write_to_eeprom) {
     rgb_matrix_config.flags = flags;
+#ifdef RGB_MATRIX_INLINE_EFFECT_RUNNERS
+    // also picks up changes made to g_led_config.flags at runtime
+    rgb_matrix_update_flag_leds(flags);
+#endif
     eeconfig_flag_rgb_matrix(write_to_eeprom);
     dprintf("rgb matrix set flags [%s]: %u\n", (write_to_eeprom) ? "EEPROM" : "NOEEPROM", rgb_matrix_config.flags);
 }
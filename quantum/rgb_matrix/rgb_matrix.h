@@ -95,6 +95,20 @@ struct rgb_matrix_limits_t {
     uint8_t led_max_index;
 };
 
+#if defined(RGB_MATRIX_RENDER_BUDGET_US) && !defined(RGB_MATRIX_RENDER_STATS)
+#    define RGB_MATRIX_RENDER_STATS
+#endif
+
+#ifdef RGB_MATRIX_RENDER_STATS
+typedef struct {
+    uint8_t  effect;             // effect the statistics were measured for
+    uint8_t  slice_size;         // number of LEDs rendered by the last task run
+    uint16_t fps;                // frames rendered per second
+    uint32_t render_time_us;     // average time spent rendering a frame
+    uint32_t render_time_max_us; // longest time spent rendering in a single task run
+} rgb_matrix_render_stats_t;
+#endif
+
 struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter);
 
 #define RGB_MATRIX_USE_LIMITS_ITER(min, max, iter)                   \
@@ -114,6 +128,24 @@ struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter);
 #define RGB_MATRIX_TEST_LED_FLAGS() \
     if (!HAS_ANY_FLAGS(g_led_config.flags[i], params->flags)) continue
 
+// Geometry of LED i relative to the center point, looked up in the tables generated from
+// the keyboard's info.json when RGB_MATRIX_LED_GEOMETRY is defined
+#ifdef RGB_MATRIX_LED_GEOMETRY
+#    define RGB_MATRIX_LED_DX(i) ((int16_t)pgm_read_word(&g_led_geometry[i].dx))
+#    define RGB_MATRIX_LED_DY(i) ((int16_t)pgm_read_word(&g_led_geometry[i].dy))
+#    define RGB_MATRIX_LED_DIST(i) pgm_read_byte(&g_led_geometry[i].dist)
+#    define RGB_MATRIX_LED_ANGLE(i) pgm_read_byte(&g_led_geometry[i].angle)
+#else
+#    define RGB_MATRIX_LED_DX(i) (g_led_config.point[i].x - k_rgb_matrix_center.x)
+#    define RGB_MATRIX_LED_DY(i) (g_led_config.point[i].y - k_rgb_matrix_center.y)
+#    define RGB_MATRIX_LED_DIST(i) sqrt16(RGB_MATRIX_LED_DX(i) * RGB_MATRIX_LED_DX(i) + RGB_MATRIX_LED_DY(i) * RGB_MATRIX_LED_DY(i))
+#    define RGB_MATRIX_LED_ANGLE(i) atan2_8(RGB_MATRIX_LED_DY(i), RGB_MATRIX_LED_DX(i))
+#endif
+
+// The generated neighbour lists hold every LED within this distance, keyboard.c asserts they
+// were generated with the same radius
+#define RGB_MATRIX_LED_NEIGHBOUR_RADIUS 40
+
 enum rgb_matrix_effects {
     RGB_MATRIX_NONE = 0,
 
@@ -220,6 +252,10 @@ void        rgb_matrix_set_flags(led_flags_t flags);
 void        rgb_matrix_set_flags_noeeprom(led_flags_t flags);
 void        rgb_matrix_update_pwm_buffers(void);
 
+#ifdef RGB_MATRIX_RENDER_STATS
+rgb_matrix_render_stats_t rgb_matrix_get_render_stats(void);
+#endif
+
 #ifndef RGBLIGHT_ENABLE
 #    define eeconfig_update_rgblight_current eeconfig_force_flush_rgb_matrix
 #    define rgblight_reload_from_eeprom rgb_matrix_reload_from_eeprom
@@ -280,8 +316,19 @@ extern rgb_config_t rgb_matrix_config;
 
 extern uint32_t     g_rgb_timer;
 extern led_config_t g_led_config;
+#ifdef RGB_MATRIX_LED_GEOMETRY
+// Generated from the keyboard's info.json, all in PROGMEM:
+//  - g_led_key: matrix position of each LED, row and col are NO_LED if it has none
+//  - g_led_neighbours: the other LEDs near LED i, closest first, are at [g_led_neighbours_offset[i], g_led_neighbours_offset[i + 1])
+extern const led_geometry_t  g_led_geometry[];
+extern const keypos_t        g_led_key[];
+extern const led_neighbour_t g_led_neighbours[];
+extern const uint16_t        g_led_neighbours_offset[];
+#endif
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
+// Position of each LED's most recent hit in g_last_hit_tracker, or UINT8_MAX
+extern uint8_t g_last_hit_led[RGB_MATRIX_LED_COUNT];
 #endif
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
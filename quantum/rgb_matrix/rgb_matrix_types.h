@@ -32,6 +32,11 @@
 #    define LED_HITS_TO_REMEMBER 8
 #endif // LED_HITS_TO_REMEMBER
 
+// Hits are dropped once their tick scaled by the effect speed reaches this, as none of the reactive effects show them anymore
+#ifndef LED_HITS_EXPIRY
+#    define LED_HITS_EXPIRY 512
+#endif // LED_HITS_EXPIRY
+
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 typedef struct PACKED {
     uint8_t  count;
@@ -75,6 +80,19 @@ typedef struct PACKED {
     uint8_t     flags[RGB_MATRIX_LED_COUNT];
 } led_config_t;
 
+// Not packed, so the 16 bit members can be read directly from flash
+typedef struct {
+    int16_t dx;    // x - center x
+    int16_t dy;    // y - center y
+    uint8_t dist;  // sqrt16(dx * dx + dy * dy)
+    uint8_t angle; // atan2_8(dy, dx)
+} led_geometry_t;
+
+typedef struct PACKED {
+    uint8_t led;
+    uint8_t dist;
+} led_neighbour_t;
+
 typedef union rgb_config_t {
     uint64_t raw;
     struct PACKED {
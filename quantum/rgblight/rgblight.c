@@ -138,6 +138,10 @@ __attribute__((weak)) rgb_t rgblight_hsv_to_rgb(hsv_t hsv) {
     return hsv_to_rgb(hsv);
 }
 
+__attribute__((weak)) void rgblight_hsv_to_rgb_batch(const hsv_t *hsv, rgb_t *rgb, uint8_t count) {
+    hsv_to_rgb_batch(hsv, rgb, count, rgblight_hsv_to_rgb);
+}
+
 uint8_t rgblight_led_index(uint8_t index) {
 #if defined(RGBLIGHT_LED_MAP)
     return pgm_read_byte(&led_map[index]) - rgblight_ranges.clipping_start_pos;
@@ -146,8 +150,97 @@ uint8_t rgblight_led_index(uint8_t index) {
 #endif
 }
 
+#ifdef RGBLIGHT_FRAMEBUFFER
+// Everything rendered by effects and layers, indexed like the driver. Only LEDs that changed
+// are passed on to the driver, and the strip is only flushed if any did.
+static rgb_t   rgblight_framebuffer[RGBLIGHT_LED_COUNT];
+static uint8_t rgblight_dirty[(RGBLIGHT_LED_COUNT + 7) / 8];
+static bool    rgblight_any_dirty     = false;
+static bool    rgblight_rendering     = false;
+static bool    rgblight_flush_pending = false;
+// Frames rendered by animations are flushed every RGBLIGHT_FRAMEBUFFER_FLUSH_INTERVAL ms, in
+// steps spread over several task runs: RGBLIGHT_FRAMEBUFFER_FLUSH_LIMIT dirty LEDs are passed to
+// the driver per run, and the strip is pushed in a run of its own.
+static uint8_t  rgblight_flush_pos   = 0;
+static bool     rgblight_flush_push  = false;
+static uint16_t rgblight_flush_timer = 0;
+#endif
+
+static void rgblight_set_color(uint8_t index, uint8_t r, uint8_t g, uint8_t b) {
+#ifdef RGBLIGHT_FRAMEBUFFER
+    if (index >= RGBLIGHT_LED_COUNT) {
+        return;
+    }
+    rgb_t *led = &rgblight_framebuffer[index];
+    if (led->r != r || led->g != g || led->b != b) {
+        led->r = r;
+        led->g = g;
+        led->b = b;
+        rgblight_dirty[index / 8] |= 1 << (index % 8);
+        rgblight_any_dirty = true;
+    }
+#else
+    rgblight_driver.set_color(index, r, g, b);
+#endif
+}
+
+#ifdef RGBLIGHT_FRAMEBUFFER
+// Passes up to limit dirty LEDs, from rgblight_flush_pos on, to the driver. Returns true once the end of the strip is reached.
+static bool rgblight_flush_leds(uint8_t limit) {
+    if (rgblight_flush_pos == 0) {
+        // LEDs changed from here on are flushed again, even if the pass has already gone past them
+        rgblight_any_dirty = false;
+    }
+    while (rgblight_flush_pos < RGBLIGHT_LED_COUNT) {
+        uint8_t i = rgblight_flush_pos;
+        if (rgblight_dirty[i / 8] & (1 << (i % 8))) {
+            if (limit == 0) {
+                return false;
+            }
+            limit--;
+            rgblight_dirty[i / 8] &= ~(1 << (i % 8));
+            rgblight_driver.set_color(i, rgblight_framebuffer[i].r, rgblight_framebuffer[i].g, rgblight_framebuffer[i].b);
+        }
+        rgblight_flush_pos++;
+    }
+    rgblight_flush_pos = 0;
+    return true;
+}
+
+// Continues a flush of the frames rendered by animations, one step per call
+static void rgblight_flush_task(void) {
+    if (rgblight_flush_push) {
+        rgblight_flush_push    = false;
+        rgblight_flush_pending = false;
+        rgblight_flush_timer   = timer_read();
+        rgblight_driver.flush();
+    } else if (rgblight_flush_pos == 0 && !rgblight_any_dirty) {
+        // the frames rendered since the last flush changed nothing
+        rgblight_flush_pending = false;
+    } else if (rgblight_flush_leds(RGBLIGHT_FRAMEBUFFER_FLUSH_LIMIT)) {
+        rgblight_flush_push = true;
+    }
+}
+#endif
+
+static void rgblight_flush(void) {
+#ifdef RGBLIGHT_FRAMEBUFFER
+    // Finishes a flush in progress too
+    bool in_progress       = rgblight_flush_pos != 0 || rgblight_flush_push;
+    rgblight_flush_pending = false;
+    rgblight_flush_push    = false;
+    if (!rgblight_any_dirty && !in_progress) {
+        return;
+    }
+    rgblight_flush_pos = 0;
+    rgblight_flush_leds(RGBLIGHT_LED_COUNT);
+    rgblight_flush_timer = timer_read();
+#endif
+    rgblight_driver.flush();
+}
+
 void setrgb(uint8_t r, uint8_t g, uint8_t b, int index) {
-    rgblight_driver.set_color(rgblight_led_index(index), r, g, b);
+    rgblight_set_color(rgblight_led_index(index), r, g, b);
 }
 
 void sethsv_raw(uint8_t hue, uint8_t sat, uint8_t val, int index) {
@@ -160,6 +253,23 @@ void sethsv(uint8_t hue, uint8_t sat, uint8_t val, int index) {
     sethsv_raw(hue, sat, val > RGBLIGHT_LIMIT_VAL ? RGBLIGHT_LIMIT_VAL : val, index);
 }
 
+#if defined(RGBLIGHT_EFFECT_RAINBOW_SWIRL) || defined(RGBLIGHT_EFFECT_STATIC_GRADIENT)
+// Sets consecutive LEDs to up to RGBLIGHT_HSV_BATCH_SIZE colors, converted in one go
+static void sethsv_batch(hsv_t *hsv, uint8_t count, int index) {
+    rgb_t rgb[RGBLIGHT_HSV_BATCH_SIZE];
+
+    for (uint8_t i = 0; i < count; i++) {
+        if (hsv[i].v > RGBLIGHT_LIMIT_VAL) {
+            hsv[i].v = RGBLIGHT_LIMIT_VAL;
+        }
+    }
+    rgblight_hsv_to_rgb_batch(hsv, rgb, count);
+    for (uint8_t i = 0; i < count; i++) {
+        setrgb(rgb[i].r, rgb[i].g, rgb[i].b, index + i);
+    }
+}
+#endif
+
 void rgblight_check_config(void) {
     /* Add some out of bound checks for RGB light config */
 
@@ -546,6 +656,8 @@ void rgblight_sethsv_eeprom_helper(uint8_t hue, uint8_t sat, uint8_t val, bool w
                 bool    direction = (delta % 2) == 0;
 
                 uint8_t range = pgm_read_byte(&RGBLED_GRADIENT_RANGES[delta / 2]);
+                hsv_t   batch[RGBLIGHT_HSV_BATCH_SIZE];
+                uint8_t count = 0;
                 for (uint8_t i = 0; i < rgblight_ranges.effect_num_leds; i++) {
                     uint8_t _hue = ((uint16_t)i * (uint16_t)range) / rgblight_ranges.effect_num_leds;
                     if (direction) {
@@ -554,7 +666,11 @@ void rgblight_sethsv_eeprom_helper(uint8_t hue, uint8_t sat, uint8_t val, bool w
                         _hue = hue - _hue;
                     }
                     dprintf("rgblight rainbow set hsv: %d,%d,%d,%u\n", i, _hue, direction, range);
-                    sethsv(_hue, sat, val, i + rgblight_ranges.effect_start_pos);
+                    batch[count++] = (hsv_t){_hue, sat, val};
+                    if (count == RGBLIGHT_HSV_BATCH_SIZE || i + 1 == rgblight_ranges.effect_num_leds) {
+                        sethsv_batch(batch, count, i + 1 - count + rgblight_ranges.effect_start_pos);
+                        count = 0;
+                    }
                 }
 #    ifdef RGBLIGHT_LAYERS_RETAIN_VAL
                 // needed for rgblight_layers_write() to get the new val, since it reads rgblight_config.val
@@ -628,7 +744,7 @@ void rgblight_setrgb(uint8_t r, uint8_t g, uint8_t b) {
     }
 
     for (uint8_t i = rgblight_ranges.effect_start_pos; i < rgblight_ranges.effect_end_pos; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i), r, g, b);
+        rgblight_set_color(rgblight_led_index(i), r, g, b);
     }
     rgblight_set();
 }
@@ -638,7 +754,7 @@ void rgblight_setrgb_at(uint8_t r, uint8_t g, uint8_t b, uint8_t index) {
         return;
     }
 
-    rgblight_driver.set_color(rgblight_led_index(index), r, g, b);
+    rgblight_set_color(rgblight_led_index(index), r, g, b);
     rgblight_set();
 }
 
@@ -669,7 +785,7 @@ void rgblight_setrgb_range(uint8_t r, uint8_t g, uint8_t b, uint8_t start, uint8
     }
 
     for (uint8_t i = start; i < end; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i), r, g, b);
+        rgblight_set_color(rgblight_led_index(i), r, g, b);
     }
     rgblight_set();
 }
@@ -861,7 +977,7 @@ void rgblight_wakeup(void) {
 void rgblight_set(void) {
     if (!rgblight_config.enable) {
         for (uint8_t i = rgblight_ranges.effect_start_pos; i < rgblight_ranges.effect_end_pos; i++) {
-            rgblight_driver.set_color(rgblight_led_index(i), 0, 0, 0);
+            rgblight_set_color(rgblight_led_index(i), 0, 0, 0);
         }
     }
 
@@ -877,7 +993,14 @@ void rgblight_set(void) {
     }
 #endif
 
-    rgblight_driver.flush();
+#ifdef RGBLIGHT_FRAMEBUFFER
+    if (rgblight_rendering) {
+        // flushed by later task runs, so rendering and flushing don't add up in one loop iteration
+        rgblight_flush_pending = true;
+        return;
+    }
+#endif
+    rgblight_flush();
 }
 
 #ifdef RGBLIGHT_SPLIT
@@ -981,6 +1104,14 @@ static void rgblight_effect_dummy(animation_status_t *anim) {
 }
 
 void rgblight_timer_task(void) {
+#    ifdef RGBLIGHT_FRAMEBUFFER
+    // Frames rendered in the meantime are flushed together, and no rendering happens while flushing
+    if (rgblight_flush_pending && timer_elapsed(rgblight_flush_timer) >= RGBLIGHT_FRAMEBUFFER_FLUSH_INTERVAL) {
+        rgblight_flush_task();
+        return;
+    }
+#    endif
+
     if (rgblight_status.timer_enabled) {
         effect_func_t effect_func   = rgblight_effect_dummy;
         uint16_t      interval_time = 2000; // dummy interval
@@ -1073,7 +1204,13 @@ void rgblight_timer_task(void) {
             oldpos16 = animation_status.pos16;
 #    endif
             animation_status.last_timer += interval_time;
+#    ifdef RGBLIGHT_FRAMEBUFFER
+            rgblight_rendering = true;
+            effect_func(&animation_status);
+            rgblight_rendering = false;
+#    else
             effect_func(&animation_status);
+#    endif
 #    if defined(RGBLIGHT_SPLIT) && !defined(RGBLIGHT_SPLIT_NO_ANIMATION_SYNC)
             if (animation_status.pos16 == 0 && oldpos16 != 0) {
                 tick_flag = true;
@@ -1156,12 +1293,17 @@ void rgblight_effect_rainbow_mood(animation_status_t *anim) {
 __attribute__((weak)) const uint8_t RGBLED_RAINBOW_SWIRL_INTERVALS[] PROGMEM = {100, 50, 20};
 
 void rgblight_effect_rainbow_swirl(animation_status_t *anim) {
-    uint8_t hue;
+    hsv_t   batch[RGBLIGHT_HSV_BATCH_SIZE];
+    uint8_t count = 0;
     uint8_t i;
 
     for (i = 0; i < rgblight_ranges.effect_num_leds; i++) {
-        hue = (RGBLIGHT_RAINBOW_SWIRL_RANGE / rgblight_ranges.effect_num_leds * i + anim->current_hue);
-        sethsv(hue, rgblight_config.sat, rgblight_config.val, i + rgblight_ranges.effect_start_pos);
+        uint8_t hue    = (RGBLIGHT_RAINBOW_SWIRL_RANGE / rgblight_ranges.effect_num_leds * i + anim->current_hue);
+        batch[count++] = (hsv_t){hue, rgblight_config.sat, rgblight_config.val};
+        if (count == RGBLIGHT_HSV_BATCH_SIZE || i + 1 == rgblight_ranges.effect_num_leds) {
+            sethsv_batch(batch, count, i + 1 - count + rgblight_ranges.effect_start_pos);
+            count = 0;
+        }
     }
     rgblight_set();
 
@@ -1198,7 +1340,7 @@ void rgblight_effect_snake(animation_status_t *anim) {
 #    endif
 
     for (i = 0; i < rgblight_ranges.effect_num_leds; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i + rgblight_ranges.effect_start_pos), 0, 0, 0);
+        rgblight_set_color(rgblight_led_index(i + rgblight_ranges.effect_start_pos), 0, 0, 0);
 
         for (j = 0; j < RGBLIGHT_EFFECT_SNAKE_LENGTH; j++) {
             k = pos + j * increment;
@@ -1254,7 +1396,7 @@ void rgblight_effect_knight(animation_status_t *anim) {
 #    endif
     // Set all the LEDs to 0
     for (i = rgblight_ranges.effect_start_pos; i < rgblight_ranges.effect_end_pos; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i), 0, 0, 0);
+        rgblight_set_color(rgblight_led_index(i), 0, 0, 0);
     }
     // Determine which LEDs should be lit up
     for (i = 0; i < RGBLIGHT_EFFECT_KNIGHT_LED_NUM; i++) {
@@ -1263,7 +1405,7 @@ void rgblight_effect_knight(animation_status_t *anim) {
         if (i >= low_bound && i <= high_bound) {
             sethsv(rgblight_config.hue, rgblight_config.sat, rgblight_config.val, cur);
         } else {
-            rgblight_driver.set_color(rgblight_led_index(cur), 0, 0, 0);
+            rgblight_set_color(rgblight_led_index(cur), 0, 0, 0);
         }
     }
     rgblight_set();
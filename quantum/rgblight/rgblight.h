@@ -166,6 +166,19 @@ enum RGBLIGHT_EFFECT_MODE {
 #    define RGBLIGHT_LIMIT_VAL 255
 #endif
 
+#ifndef RGBLIGHT_HSV_BATCH_SIZE
+#    define RGBLIGHT_HSV_BATCH_SIZE 8
+#endif
+
+#ifdef RGBLIGHT_FRAMEBUFFER
+#    ifndef RGBLIGHT_FRAMEBUFFER_FLUSH_INTERVAL
+#        define RGBLIGHT_FRAMEBUFFER_FLUSH_INTERVAL 16
+#    endif
+#    ifndef RGBLIGHT_FRAMEBUFFER_FLUSH_LIMIT
+#        define RGBLIGHT_FRAMEBUFFER_FLUSH_LIMIT 16
+#    endif
+#endif
+
 #include <stdint.h>
 #include <stdbool.h>
 #include "rgblight_drivers.h"
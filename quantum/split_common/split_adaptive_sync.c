@@ -0,0 +1,52 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "split_adaptive_sync.h"
+
+// The baseline moves 1/8th of the way towards each cycle's count
+#define BASELINE_WEIGHT_SHIFT 3
+
+static uint32_t critical_transactions(const split_sync_state_t *state, uint32_t transactions) {
+    return transactions - state->cycle_transactions - state->deferrable_transactions;
+}
+
+void split_sync_cycle_start(split_sync_state_t *state, uint32_t transactions, uint32_t failures) {
+    state->cycle_transactions      = transactions;
+    state->cycle_failures          = failures;
+    state->deferrable_transactions = 0;
+}
+
+void split_sync_cycle_end(split_sync_state_t *state, uint32_t transactions, uint32_t failures) {
+    uint32_t critical = critical_transactions(state, transactions);
+    if (critical > 255) {
+        critical = 255;
+    }
+
+    if (state->baseline_valid) {
+        state->baseline += ((int32_t)(critical << 4) - (int32_t)state->baseline) / (1 << BASELINE_WEIGHT_SHIFT);
+    } else {
+        state->baseline       = critical << 4;
+        state->baseline_valid = true;
+    }
+
+    // A failing cycle defers cosmetic syncs on the next one, giving the link back to key events
+    state->last_cycle_failed = failures != state->cycle_failures;
+}
+
+void split_sync_deferrable_ran(split_sync_state_t *state, uint32_t transactions) {
+    state->deferrable_transactions += transactions;
+}
+
+bool split_sync_defer(const split_sync_state_t *state, uint32_t transactions, uint32_t elapsed, uint16_t max_defer_ms) {
+    if (max_defer_ms == 0 || elapsed >= max_defer_ms) {
+        return false;
+    }
+    if (state->last_cycle_failed) {
+        return true;
+    }
+    if (!state->baseline_valid) {
+        return false;
+    }
+    // Busy once this cycle synced more latency-critical data than usual, e.g. matrix, layer or mods changes
+    return critical_transactions(state, transactions) >= (uint32_t)((state->baseline + 8) >> 4) + SPLIT_SYNC_BUSY_TRANSACTIONS;
+}
@@ -0,0 +1,46 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Transactions for latency-critical data above the usual amount that make a scan cycle busy */
+#ifndef SPLIT_SYNC_BUSY_TRANSACTIONS
+#    define SPLIT_SYNC_BUSY_TRANSACTIONS 1
+#endif // SPLIT_SYNC_BUSY_TRANSACTIONS
+
+typedef struct _split_sync_state_t {
+    uint32_t cycle_transactions;      // transport transaction count at the start of the cycle
+    uint32_t cycle_failures;          // transport failure count at the start of the cycle
+    uint32_t deferrable_transactions; // transactions run by deferrable handlers this cycle
+    uint16_t baseline;                // running average of latency-critical transactions per cycle, in 1/16ths
+    bool     baseline_valid;
+    bool     last_cycle_failed;
+} split_sync_state_t;
+
+/**
+ * \brief Starts a scan cycle, given the transport statistics at that point.
+ */
+void split_sync_cycle_start(split_sync_state_t *state, uint32_t transactions, uint32_t failures);
+
+/**
+ * \brief Ends a scan cycle, folding its latency-critical transactions into the baseline.
+ */
+void split_sync_cycle_end(split_sync_state_t *state, uint32_t transactions, uint32_t failures);
+
+/**
+ * \brief Records the transactions run by a deferrable handler, so they don't count towards the cycle being busy.
+ */
+void split_sync_deferrable_ran(split_sync_state_t *state, uint32_t transactions);
+
+/**
+ * \brief Checks whether a deferrable handler should be skipped this cycle.
+ *
+ * \param transactions the transport transaction count so far
+ * \param elapsed milliseconds since the handler last ran
+ * \param max_defer_ms longest the handler may be skipped for, 0 to never skip it
+ * \return true while the link is busy and the handler ran less than max_defer_ms ago
+ */
+bool split_sync_defer(const split_sync_state_t *state, uint32_t transactions, uint32_t elapsed, uint16_t max_defer_ms);
@@ -0,0 +1,89 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "split_oled_rle.h"
+
+#include <string.h>
+#include "crc.h"
+
+/*
+    Display blocks are run-length encoded: a control byte c below 128 is
+    followed by c + 1 literal bytes, and a control byte of 128 or above by a
+    single byte that is repeated c - 125 times. Only runs of at least 3 bytes
+    are encoded as repeats, so a block never grows by more than a byte per
+    128 bytes.
+*/
+uint8_t split_oled_rle_encode(const uint8_t *src, uint8_t length, uint8_t *dest) {
+    uint8_t in = 0, out = 0;
+
+    while (in < length) {
+        uint8_t run = 1;
+        while (in + run < length && run < 130 && src[in + run] == src[in]) {
+            run++;
+        }
+
+        if (run >= 3) {
+            dest[out++] = run + 125;
+            dest[out++] = src[in];
+            in += run;
+        } else {
+            uint8_t start = in;
+            // extend the literal up to the next run worth encoding
+            while (in < length && in - start < 128 && !(in + 2 < length && src[in] == src[in + 1] && src[in] == src[in + 2])) {
+                in++;
+            }
+            dest[out++] = in - start - 1;
+            memcpy(&dest[out], &src[start], in - start);
+            out += in - start;
+        }
+    }
+    return out;
+}
+
+bool split_oled_rle_decode(const uint8_t *src, uint8_t length, uint8_t *dest, uint8_t size) {
+    uint8_t in = 0, out = 0;
+
+    while (in < length) {
+        uint8_t control = src[in++];
+        if (control < 128) {
+            uint8_t count = control + 1;
+            if (count > length - in || count > size - out) {
+                return false;
+            }
+            memcpy(&dest[out], &src[in], count);
+            in += count;
+            out += count;
+        } else {
+            uint8_t count = control - 125;
+            if (in >= length || count > size - out) {
+                return false;
+            }
+            memset(&dest[out], src[in++], count);
+            out += count;
+        }
+    }
+    return out == size;
+}
+
+void split_oled_commit(split_oled_commit_t *commit, uint8_t sequence, const uint8_t *payload) {
+    commit->checksum = crc8(payload, 1 + payload[0]);
+    commit->sequence = sequence;
+}
+
+bool split_oled_take(const split_oled_commit_t *commit, uint8_t ack, const uint8_t *payload, uint8_t size, uint8_t *dest, uint8_t *sequence) {
+    split_oled_commit_t seen;
+    memcpy(&seen, commit, sizeof(seen));
+    if (seen.sequence == ack) {
+        return false;
+    }
+
+    // The commit is written after the payload, but a copy may still be torn by the next payload
+    // being written over it, or by the commit itself being only half written.
+    memcpy(dest, payload, size);
+    if (dest[0] >= size || crc8(dest, 1 + dest[0]) != seen.checksum) {
+        return false;
+    }
+
+    *sequence = seen.sequence;
+    return true;
+}
@@ -0,0 +1,62 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Upper bound of the encoded size of `length` bytes, see split_oled_rle_encode() */
+#define SPLIT_OLED_RLE_MAX_SIZE(length) ((length) + ((length) + 127) / 128)
+
+/**
+ * \brief Run-length encodes a display block for transfer to the other half.
+ *
+ * \param src the bytes to encode
+ * \param length number of bytes to encode
+ * \param dest buffer of at least SPLIT_OLED_RLE_MAX_SIZE(length) bytes
+ * \return the encoded size
+ */
+uint8_t split_oled_rle_encode(const uint8_t *src, uint8_t length, uint8_t *dest);
+
+/**
+ * \brief Decodes the output of split_oled_rle_encode().
+ *
+ * \param src the encoded bytes
+ * \param length the encoded size
+ * \param dest buffer receiving the decoded bytes
+ * \param size size of `dest`
+ * \return true if the encoded data was well formed and decoded to exactly `size` bytes
+ */
+bool split_oled_rle_decode(const uint8_t *src, uint8_t length, uint8_t *dest, uint8_t size);
+
+/* Published in its own transaction once a payload has been written, the sequence being the last byte written */
+typedef struct _split_oled_commit_t {
+    uint8_t checksum; // crc8 of the payload, its length byte included
+    uint8_t sequence;
+} split_oled_commit_t;
+
+/**
+ * \brief Seals a payload for the other half.
+ *
+ * \param commit receives the commit to publish after the payload
+ * \param sequence sequence number of the payload
+ * \param payload the length byte followed by that many bytes of records
+ */
+void split_oled_commit(split_oled_commit_t *commit, uint8_t sequence, const uint8_t *payload);
+
+/**
+ * \brief Takes a payload published by the other half, once it has been written completely.
+ *
+ * The payload may still be being written byte by byte while it is read, a payload not matching
+ * its commit is left for a later attempt.
+ *
+ * \param commit the commit published by the other half
+ * \param ack sequence of the last payload taken
+ * \param payload the payload written by the other half
+ * \param size size of `payload`
+ * \param dest buffer of `size` bytes receiving a copy of the payload
+ * \param sequence receives the sequence of the payload taken
+ * \return true if a new, complete payload was copied to `dest`
+ */
+bool split_oled_take(const split_oled_commit_t *commit, uint8_t ack, const uint8_t *payload, uint8_t size, uint8_t *dest, uint8_t *sequence);
@@ -0,0 +1,19 @@
+split_oled_rle_SRC := \
+    $(QUANTUM_PATH)/split_common/tests/split_oled_rle_tests.cpp \
+    $(QUANTUM_PATH)/split_common/split_oled_rle.c \
+    $(QUANTUM_PATH)/crc.c
+split_oled_rle_INC := \
+    $(QUANTUM_PATH)/split_common
+
+split_oled_sync_SRC := \
+    $(QUANTUM_PATH)/split_common/tests/split_oled_sync_tests.cpp \
+    $(QUANTUM_PATH)/split_common/split_oled_rle.c \
+    $(QUANTUM_PATH)/crc.c
+split_oled_sync_INC := \
+    $(QUANTUM_PATH)/split_common
+
+split_adaptive_sync_SRC := \
+    $(QUANTUM_PATH)/split_common/tests/split_adaptive_sync_tests.cpp \
+    $(QUANTUM_PATH)/split_common/split_adaptive_sync.c
+split_adaptive_sync_INC := \
+    $(QUANTUM_PATH)/split_common
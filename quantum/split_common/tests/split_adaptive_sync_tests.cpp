@@ -0,0 +1,110 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "split_adaptive_sync.h"
+}
+
+#define MAX_DEFER_MS 50
+
+class SplitAdaptiveSync : public ::testing::Test {
+   protected:
+    split_sync_state_t state        = {};
+    uint32_t           transactions = 0;
+    uint32_t           failures     = 0;
+
+    void StartCycle(uint32_t critical) {
+        split_sync_cycle_start(&state, transactions, failures);
+        transactions += critical;
+    }
+
+    void RunDeferrable(uint32_t count) {
+        transactions += count;
+        split_sync_deferrable_ran(&state, count);
+    }
+
+    void EndCycle(void) {
+        split_sync_cycle_end(&state, transactions, failures);
+    }
+
+    // Cycles with the same amount of latency-critical transactions, settling the baseline
+    void IdleCycles(uint32_t critical, int count) {
+        for (int i = 0; i < count; ++i) {
+            StartCycle(critical);
+            EndCycle();
+        }
+    }
+
+    bool Defer(uint32_t elapsed = 0, uint16_t max_defer_ms = MAX_DEFER_MS) {
+        return split_sync_defer(&state, transactions, elapsed, max_defer_ms);
+    }
+};
+
+TEST_F(SplitAdaptiveSync, FirstCycleIsNotDeferred) {
+    StartCycle(10);
+    EXPECT_FALSE(Defer());
+}
+
+TEST_F(SplitAdaptiveSync, UsualTrafficIsNotDeferred) {
+    IdleCycles(2, 20);
+    StartCycle(2);
+    EXPECT_FALSE(Defer());
+    StartCycle(1);
+    EXPECT_FALSE(Defer());
+}
+
+TEST_F(SplitAdaptiveSync, MoreCriticalTransactionsThanUsualDefer) {
+    IdleCycles(2, 20);
+    StartCycle(2 + SPLIT_SYNC_BUSY_TRANSACTIONS);
+    EXPECT_TRUE(Defer());
+}
+
+TEST_F(SplitAdaptiveSync, DeferrableTransactionsAreNotCounted) {
+    IdleCycles(2, 20);
+    StartCycle(2);
+    RunDeferrable(5);
+    EXPECT_FALSE(Defer());
+    EndCycle();
+
+    // ...nor do they move the baseline
+    StartCycle(2 + SPLIT_SYNC_BUSY_TRANSACTIONS);
+    EXPECT_TRUE(Defer());
+}
+
+TEST_F(SplitAdaptiveSync, MaxDeferForcesSync) {
+    IdleCycles(2, 20);
+    StartCycle(10);
+    EXPECT_TRUE(Defer(MAX_DEFER_MS - 1));
+    EXPECT_FALSE(Defer(MAX_DEFER_MS));
+    EXPECT_FALSE(Defer(0, 0));
+}
+
+TEST_F(SplitAdaptiveSync, FailedCycleDefersTheNext) {
+    IdleCycles(2, 20);
+    StartCycle(2);
+    failures++;
+    EndCycle();
+
+    StartCycle(2);
+    EXPECT_TRUE(Defer());
+    EXPECT_FALSE(Defer(MAX_DEFER_MS));
+    EndCycle();
+
+    StartCycle(2);
+    EXPECT_FALSE(Defer());
+}
+
+TEST_F(SplitAdaptiveSync, BaselineFollowsSustainedTraffic) {
+    IdleCycles(2, 20);
+    StartCycle(4);
+    EXPECT_TRUE(Defer());
+    EndCycle();
+
+    IdleCycles(4, 40);
+    StartCycle(4);
+    EXPECT_FALSE(Defer());
+    StartCycle(5);
+    EXPECT_TRUE(Defer());
+}
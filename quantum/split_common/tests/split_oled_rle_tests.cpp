@@ -0,0 +1,113 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+extern "C" {
+#include "split_oled_rle.h"
+}
+
+class SplitOledRle : public ::testing::Test {
+   protected:
+    std::vector<uint8_t> encoded;
+
+    void RoundTrip(const std::vector<uint8_t> &block) {
+        encoded.assign(SPLIT_OLED_RLE_MAX_SIZE(block.size()), 0xAA);
+        uint8_t length = split_oled_rle_encode(block.data(), block.size(), encoded.data());
+        ASSERT_LE(length, SPLIT_OLED_RLE_MAX_SIZE(block.size()));
+        encoded.resize(length);
+
+        std::vector<uint8_t> decoded(block.size(), 0x55);
+        ASSERT_TRUE(split_oled_rle_decode(encoded.data(), encoded.size(), decoded.data(), decoded.size()));
+        EXPECT_EQ(decoded, block);
+    }
+};
+
+TEST_F(SplitOledRle, BlankBlockIsOneRunPerMaximumLength) {
+    RoundTrip(std::vector<uint8_t>(128, 0x00));
+    EXPECT_EQ(encoded, (std::vector<uint8_t>{128 + 125, 0x00}));
+
+    // 130 is the longest run, the remaining 70 bytes follow in a second one
+    RoundTrip(std::vector<uint8_t>(200, 0xFF));
+    EXPECT_EQ(encoded, (std::vector<uint8_t>{130 + 125, 0xFF, 70 + 125, 0xFF}));
+}
+
+TEST_F(SplitOledRle, RunOfMaximumLengthPlusOneEndsInLiteral) {
+    RoundTrip(std::vector<uint8_t>(131, 0x42));
+    EXPECT_EQ(encoded, (std::vector<uint8_t>{130 + 125, 0x42, 0, 0x42}));
+}
+
+TEST_F(SplitOledRle, NoisyBlockGrowsByOneBytePer128) {
+    std::vector<uint8_t> block(240);
+    for (size_t i = 0; i < block.size(); i++) {
+        block[i] = i;
+    }
+    RoundTrip(block);
+    ASSERT_EQ(encoded.size(), block.size() + 2);
+    // 128 is the longest literal
+    EXPECT_EQ(encoded[0], 127);
+    EXPECT_EQ(encoded[1 + 128], 240 - 128 - 1);
+}
+
+TEST_F(SplitOledRle, OnlyRunsOfThreeOrMoreAreEncoded) {
+    // two equal bytes stay in the literal, three start a run right after it
+    RoundTrip({1, 2, 2, 3, 4, 4, 4, 5});
+    EXPECT_EQ(encoded, (std::vector<uint8_t>{3, 1, 2, 2, 3, 3 + 125, 4, 0, 5}));
+
+    // a run at the very start and end
+    RoundTrip({7, 7, 7, 1, 9, 9, 9});
+    EXPECT_EQ(encoded, (std::vector<uint8_t>{3 + 125, 7, 0, 1, 3 + 125, 9}));
+
+    // a pair at the very end
+    RoundTrip({7, 7, 7, 9, 9});
+    EXPECT_EQ(encoded, (std::vector<uint8_t>{3 + 125, 7, 1, 9, 9}));
+}
+
+TEST_F(SplitOledRle, LiteralOfMaximumLengthIsFollowedByRun) {
+    std::vector<uint8_t> block(128 + 5);
+    for (size_t i = 0; i < 128; i++) {
+        block[i] = i;
+    }
+    std::fill(block.begin() + 128, block.end(), 0xEE);
+    RoundTrip(block);
+    ASSERT_EQ(encoded.size(), 1 + 128 + 2);
+    EXPECT_EQ(encoded[0], 127);
+    EXPECT_EQ(encoded[1 + 128], 5 + 125);
+    EXPECT_EQ(encoded[2 + 128], 0xEE);
+}
+
+TEST_F(SplitOledRle, MixedBlocksRoundTrip) {
+    std::vector<uint8_t> block(256 - 16);
+    uint32_t             state = 12345;
+    for (int iteration = 0; iteration < 200; iteration++) {
+        for (size_t i = 0; i < block.size(); i++) {
+            state = state * 1103515245 + 12345;
+            // bias towards repeats, so that runs of every length show up
+            block[i] = (state >> 16) % 4 == 0 || i == 0 ? (state >> 24) : block[i - 1];
+        }
+        RoundTrip(block);
+        if (HasFailure()) {
+            break;
+        }
+    }
+}
+
+TEST_F(SplitOledRle, MalformedDataIsRejected) {
+    uint8_t decoded[4];
+
+    // literal running past the end of the data
+    const uint8_t truncated_literal[] = {3, 1, 2};
+    EXPECT_FALSE(split_oled_rle_decode(truncated_literal, sizeof(truncated_literal), decoded, sizeof(decoded)));
+
+    // run without its value
+    const uint8_t truncated_run[] = {4 + 125};
+    EXPECT_FALSE(split_oled_rle_decode(truncated_run, sizeof(truncated_run), decoded, sizeof(decoded)));
+
+    // decoding to more or fewer bytes than expected
+    const uint8_t too_long[] = {5 + 125, 0};
+    EXPECT_FALSE(split_oled_rle_decode(too_long, sizeof(too_long), decoded, sizeof(decoded)));
+    const uint8_t too_short[] = {3 + 125, 0};
+    EXPECT_FALSE(split_oled_rle_decode(too_short, sizeof(too_short), decoded, sizeof(decoded)));
+}
@@ -0,0 +1,98 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+extern "C" {
+#include "split_oled_rle.h"
+}
+
+#define PAYLOAD_SIZE 24
+
+// Shared memory of the other half, written one byte at a time as over I2C
+class SplitOledSync : public ::testing::Test {
+   protected:
+    uint8_t             payload[PAYLOAD_SIZE] = {0};
+    split_oled_commit_t commit                = {0};
+    uint8_t             ack                   = 0;
+    uint8_t             taken[PAYLOAD_SIZE];
+    uint8_t             sequence;
+
+    static std::vector<uint8_t> Payload(uint8_t length, uint8_t seed) {
+        std::vector<uint8_t> bytes = {length};
+        for (uint8_t i = 0; i < length; i++) {
+            bytes.push_back(seed + i * 7);
+        }
+        return bytes;
+    }
+
+    bool Take() {
+        return split_oled_take(&commit, ack, payload, sizeof(payload), taken, &sequence);
+    }
+
+    void ExpectTaken(const std::vector<uint8_t> &bytes, uint8_t expected_sequence) {
+        ASSERT_TRUE(Take());
+        EXPECT_EQ(sequence, expected_sequence);
+        EXPECT_EQ(std::vector<uint8_t>(taken, taken + bytes.size()), bytes);
+        ack = sequence;
+    }
+};
+
+TEST_F(SplitOledSync, PayloadIsTakenOnceCommitted) {
+    auto next = Payload(10, 0x11);
+
+    for (size_t i = 0; i < next.size(); i++) {
+        payload[i] = next[i];
+        EXPECT_FALSE(Take()) << "uncommitted payload taken after " << i + 1 << " bytes";
+    }
+
+    split_oled_commit_t next_commit;
+    split_oled_commit(&next_commit, 1, next.data());
+    commit.checksum = next_commit.checksum;
+    EXPECT_FALSE(Take()) << "half written commit taken";
+    commit.sequence = next_commit.sequence;
+    ExpectTaken(next, 1);
+
+    EXPECT_FALSE(Take());
+}
+
+TEST_F(SplitOledSync, TornPayloadIsNotTaken) {
+    auto first  = Payload(PAYLOAD_SIZE - 1, 0x20);
+    auto second = Payload(12, 0x83);
+
+    std::copy(first.begin(), first.end(), payload);
+    split_oled_commit(&commit, 1, first.data());
+
+    // the next payload is written over one not taken yet, every copy in between is torn
+    for (size_t i = 0; i < second.size(); i++) {
+        payload[i] = second[i];
+        EXPECT_FALSE(Take()) << "torn payload taken after " << i + 1 << " bytes";
+    }
+
+    split_oled_commit(&commit, 2, second.data());
+    ExpectTaken(second, 2);
+}
+
+TEST_F(SplitOledSync, SequenceWrapsPastAck) {
+    auto next = Payload(4, 0x40);
+
+    std::copy(next.begin(), next.end(), payload);
+    split_oled_commit(&commit, 255, next.data());
+    ExpectTaken(next, 255);
+
+    next = Payload(5, 0x50);
+    std::copy(next.begin(), next.end(), payload);
+    split_oled_commit(&commit, 1, next.data());
+    ExpectTaken(next, 1);
+}
+
+TEST_F(SplitOledSync, OversizedLengthIsRejected) {
+    auto next = Payload(PAYLOAD_SIZE - 1, 0x60);
+
+    std::copy(next.begin(), next.end(), payload);
+    payload[0] = PAYLOAD_SIZE;
+    split_oled_commit(&commit, 1, payload);
+    EXPECT_FALSE(Take());
+}
@@ -0,0 +1,3 @@
+TEST_LIST += split_oled_rle
+TEST_LIST += split_oled_sync
+TEST_LIST += split_adaptive_sync
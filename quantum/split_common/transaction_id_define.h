@@ -75,6 +75,11 @@ enum serial_transaction_id {
 
 #if defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
     PUT_OLED,
+#    ifdef SPLIT_OLED_MASTER_RENDER
+    PUT_OLED_BLOCKS,
+    PUT_OLED_BLOCKS_COMMIT,
+    GET_OLED_BLOCKS_ACK,
+#    endif // SPLIT_OLED_MASTER_RENDER
 #endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
 #if defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
@@ -64,6 +64,9 @@
 #ifdef WPM_ENABLE
 #    include "wpm.h"
 #endif
+#ifdef SPLIT_ADAPTIVE_SYNC
+#    include "split_adaptive_sync.h"
+#endif
 
 #define SYNC_TIMER_OFFSET 2
 
@@ -144,6 +147,66 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         split_shared_memory_unlock();                         \
     } while (0)
 
+#ifdef SPLIT_ADAPTIVE_SYNC
+
+#    ifndef SPLIT_SYNC_MAX_DEFER_MS
+#        define SPLIT_SYNC_MAX_DEFER_MS 50
+#    endif // SPLIT_SYNC_MAX_DEFER_MS
+
+// Cosmetic data, synced at least every SPLIT_<feature>_MAX_DEFER_MS while the link is busy
+#    ifndef SPLIT_BACKLIGHT_MAX_DEFER_MS
+#        define SPLIT_BACKLIGHT_MAX_DEFER_MS SPLIT_SYNC_MAX_DEFER_MS
+#    endif
+#    ifndef SPLIT_RGBLIGHT_MAX_DEFER_MS
+#        define SPLIT_RGBLIGHT_MAX_DEFER_MS SPLIT_SYNC_MAX_DEFER_MS
+#    endif
+#    ifndef SPLIT_LED_MATRIX_MAX_DEFER_MS
+#        define SPLIT_LED_MATRIX_MAX_DEFER_MS SPLIT_SYNC_MAX_DEFER_MS
+#    endif
+#    ifndef SPLIT_RGB_MATRIX_MAX_DEFER_MS
+#        define SPLIT_RGB_MATRIX_MAX_DEFER_MS SPLIT_SYNC_MAX_DEFER_MS
+#    endif
+#    ifndef SPLIT_WPM_MAX_DEFER_MS
+#        define SPLIT_WPM_MAX_DEFER_MS SPLIT_SYNC_MAX_DEFER_MS
+#    endif
+#    ifndef SPLIT_OLED_MAX_DEFER_MS
+#        define SPLIT_OLED_MAX_DEFER_MS SPLIT_SYNC_MAX_DEFER_MS
+#    endif
+#    ifndef SPLIT_ST7565_MAX_DEFER_MS
+#        define SPLIT_ST7565_MAX_DEFER_MS SPLIT_SYNC_MAX_DEFER_MS
+#    endif
+#    ifndef SPLIT_HAPTIC_MAX_DEFER_MS
+#        define SPLIT_HAPTIC_MAX_DEFER_MS SPLIT_SYNC_MAX_DEFER_MS
+#    endif
+#    ifndef SPLIT_ACTIVITY_MAX_DEFER_MS
+#        define SPLIT_ACTIVITY_MAX_DEFER_MS SPLIT_SYNC_MAX_DEFER_MS
+#    endif
+
+static split_sync_state_t split_sync_state;
+
+/**
+ * @brief Constructs a transaction handler for cosmetic data, which is skipped
+ * while this cycle synced more latency-critical data than usual or the last
+ * cycle had a failed transaction, but still runs at least every max_defer_ms.
+ * A max_defer_ms of 0 never defers the handler.
+ */
+#    define TRANSACTION_HANDLER_MASTER_DEFERRABLE(prefix, max_defer_ms)                                                              \
+        do {                                                                                                                         \
+            static uint32_t last_run = 0;                                                                                            \
+            if (!split_sync_defer(&split_sync_state, transport_get_stats().transactions, timer_elapsed32(last_run), max_defer_ms)) { \
+                uint32_t transactions = transport_get_stats().transactions;                                                          \
+                TRANSACTION_HANDLER_MASTER(prefix);                                                                                  \
+                split_sync_deferrable_ran(&split_sync_state, transport_get_stats().transactions - transactions);                     \
+                last_run = timer_read32();                                                                                           \
+            }                                                                                                                        \
+        } while (0)
+
+#else // SPLIT_ADAPTIVE_SYNC
+
+#    define TRANSACTION_HANDLER_MASTER_DEFERRABLE(prefix, max_defer_ms) TRANSACTION_HANDLER_MASTER(prefix)
+
+#endif // SPLIT_ADAPTIVE_SYNC
+
 inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length) {
     uint8_t curr_checksum;
     bool    okay = transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
@@ -481,7 +544,7 @@ static void backlight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
     backlight_level_noeeprom(backlight_level);
 }
 
-#    define TRANSACTIONS_BACKLIGHT_MASTER() TRANSACTION_HANDLER_MASTER(backlight)
+#    define TRANSACTIONS_BACKLIGHT_MASTER() TRANSACTION_HANDLER_MASTER_DEFERRABLE(backlight, SPLIT_BACKLIGHT_MAX_DEFER_MS)
 #    define TRANSACTIONS_BACKLIGHT_SLAVE() TRANSACTION_HANDLER_SLAVE(backlight)
 #    define TRANSACTIONS_BACKLIGHT_REGISTRATIONS [PUT_BACKLIGHT] = trans_initiator2target_initializer(backlight_level),
 
@@ -523,7 +586,7 @@ static void rgblight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
     }
 }
 
-#    define TRANSACTIONS_RGBLIGHT_MASTER() TRANSACTION_HANDLER_MASTER(rgblight)
+#    define TRANSACTIONS_RGBLIGHT_MASTER() TRANSACTION_HANDLER_MASTER_DEFERRABLE(rgblight, SPLIT_RGBLIGHT_MAX_DEFER_MS)
 #    define TRANSACTIONS_RGBLIGHT_SLAVE() TRANSACTION_HANDLER_SLAVE(rgblight)
 #    define TRANSACTIONS_RGBLIGHT_REGISTRATIONS [PUT_RGBLIGHT] = trans_initiator2target_initializer(rgblight_sync),
 
@@ -557,7 +620,7 @@ static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
     led_matrix_set_suspend_state(led_suspend_state);
 }
 
-#    define TRANSACTIONS_LED_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(led_matrix)
+#    define TRANSACTIONS_LED_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER_DEFERRABLE(led_matrix, SPLIT_LED_MATRIX_MAX_DEFER_MS)
 #    define TRANSACTIONS_LED_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(led_matrix)
 #    define TRANSACTIONS_LED_MATRIX_REGISTRATIONS [PUT_LED_MATRIX] = trans_initiator2target_initializer(led_matrix_sync),
 
@@ -591,7 +654,7 @@ static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
     rgb_matrix_set_suspend_state(rgb_suspend_state);
 }
 
-#    define TRANSACTIONS_RGB_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(rgb_matrix)
+#    define TRANSACTIONS_RGB_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER_DEFERRABLE(rgb_matrix, SPLIT_RGB_MATRIX_MAX_DEFER_MS)
 #    define TRANSACTIONS_RGB_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(rgb_matrix)
 #    define TRANSACTIONS_RGB_MATRIX_REGISTRATIONS [PUT_RGB_MATRIX] = trans_initiator2target_initializer(rgb_matrix_sync),
 
@@ -618,7 +681,7 @@ static void wpm_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_
     set_current_wpm(split_shmem->current_wpm);
 }
 
-#    define TRANSACTIONS_WPM_MASTER() TRANSACTION_HANDLER_MASTER(wpm)
+#    define TRANSACTIONS_WPM_MASTER() TRANSACTION_HANDLER_MASTER_DEFERRABLE(wpm, SPLIT_WPM_MAX_DEFER_MS)
 #    define TRANSACTIONS_WPM_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(wpm)
 #    define TRANSACTIONS_WPM_REGISTRATIONS [PUT_WPM] = trans_initiator2target_initializer(current_wpm),
 
@@ -653,9 +716,125 @@ static void oled_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
     }
 }
 
-#    define TRANSACTIONS_OLED_MASTER() TRANSACTION_HANDLER_MASTER(oled)
-#    define TRANSACTIONS_OLED_SLAVE() TRANSACTION_HANDLER_SLAVE(oled)
-#    define TRANSACTIONS_OLED_REGISTRATIONS [PUT_OLED] = trans_initiator2target_initializer(current_oled_state),
+#    ifdef SPLIT_OLED_MASTER_RENDER
+
+#        ifndef SPLIT_OLED_SYNC_INTERVAL
+#            define SPLIT_OLED_SYNC_INTERVAL 5
+#        endif // SPLIT_OLED_SYNC_INTERVAL
+
+STATIC_ASSERT(SPLIT_OLED_PAYLOAD_SIZE >= SPLIT_OLED_RECORD_MAX_SIZE && SPLIT_OLED_PAYLOAD_SIZE <= 250, "SPLIT_OLED_PAYLOAD_SIZE must fit at least one display block, and at most 250 bytes");
+
+static bool oled_blocks_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t last_update = 0;
+    static uint32_t last_check  = 0;
+    static uint8_t  sequence    = 0;
+    static bool     in_flight   = false;
+
+    if (timer_elapsed32(last_update) < SPLIT_OLED_SYNC_INTERVAL) {
+        return true;
+    }
+
+    // The previous payload has to be applied before sending the next one. The other half
+    // answering with a different sequence while idle means it restarted with a blank display.
+    if (in_flight || timer_elapsed32(last_check) >= FORCED_SYNC_THROTTLE_MS) {
+        uint8_t ack;
+        if (!transport_read(GET_OLED_BLOCKS_ACK, &ack, sizeof(ack))) {
+            return false;
+        }
+        last_check = timer_read32();
+        if (ack != sequence) {
+            if (in_flight && timer_elapsed32(last_update) < FORCED_SYNC_THROTTLE_MS) {
+                return true;
+            }
+            oled_remote_mark_dirty(OLED_BLOCK_COUNT);
+        }
+        in_flight = false;
+    }
+
+    split_oled_sync_t payload = {0};
+    uint8_t           record[SPLIT_OLED_RECORD_MAX_SIZE];
+    const uint8_t    *data;
+    uint8_t           block;
+
+    while ((data = oled_remote_next_dirty_block(&block)) != NULL) {
+        record[0]   = block;
+        record[1]   = split_oled_rle_encode(data, OLED_BLOCK_SIZE, &record[2]);
+        uint8_t len = 2 + record[1];
+        if (len > SPLIT_OLED_PAYLOAD_SIZE - payload.length) {
+            // send it with the next payload
+            oled_remote_mark_dirty(block);
+            break;
+        }
+        memcpy(&payload.data[payload.length], record, len);
+        payload.length += len;
+    }
+
+    if (payload.length == 0) {
+        return true;
+    }
+
+    // Shared memory is written byte by byte on some transports, the other half only takes
+    // the payload once the commit following it has been written.
+    split_oled_commit_t commit;
+    split_oled_commit(&commit, sequence + 1 != 0 ? sequence + 1 : 1, &payload.length);
+    if (!transport_write(PUT_OLED_BLOCKS, &payload, offsetof(split_oled_sync_t, data) + payload.length) || !transport_write(PUT_OLED_BLOCKS_COMMIT, &commit, sizeof(commit))) {
+        oled_remote_mark_dirty(OLED_BLOCK_COUNT);
+        return false;
+    }
+
+    sequence    = commit.sequence;
+    in_flight   = true;
+    last_update = timer_read32();
+    return true;
+}
+
+static void oled_blocks_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    split_oled_sync_t payload;
+    uint8_t           sequence;
+
+    split_shared_memory_lock();
+    bool pending = split_oled_take(&split_shmem->oled_sync_commit, split_shmem->oled_sync_ack, &split_shmem->oled_sync.length, sizeof(payload), &payload.length, &sequence);
+    split_shared_memory_unlock();
+
+    if (!pending) {
+        return;
+    }
+
+    uint8_t block[OLED_BLOCK_SIZE];
+    uint8_t offset = 0;
+    while (payload.length >= 2 && offset <= payload.length - 2 && payload.data[offset + 1] <= payload.length - offset - 2) {
+        if (split_oled_rle_decode(&payload.data[offset + 2], payload.data[offset + 1], block, OLED_BLOCK_SIZE)) {
+            oled_write_block(payload.data[offset], block);
+        }
+        offset += 2 + payload.data[offset + 1];
+    }
+
+    split_shared_memory_lock();
+    split_shmem->oled_sync_ack = sequence;
+    split_shared_memory_unlock();
+}
+
+// clang-format off
+#        define TRANSACTIONS_OLED_MASTER() \
+    TRANSACTION_HANDLER_MASTER_DEFERRABLE(oled, SPLIT_OLED_MAX_DEFER_MS); \
+    TRANSACTION_HANDLER_MASTER_DEFERRABLE(oled_blocks, SPLIT_OLED_MAX_DEFER_MS)
+#        define TRANSACTIONS_OLED_SLAVE() \
+    TRANSACTION_HANDLER_SLAVE(oled); \
+    TRANSACTION_HANDLER_SLAVE(oled_blocks)
+#        define TRANSACTIONS_OLED_REGISTRATIONS \
+    [PUT_OLED]               = trans_initiator2target_initializer(current_oled_state), \
+    [PUT_OLED_BLOCKS]        = trans_initiator2target_initializer(oled_sync), \
+    [PUT_OLED_BLOCKS_COMMIT] = trans_initiator2target_initializer(oled_sync_commit), \
+    [GET_OLED_BLOCKS_ACK]    = trans_target2initiator_initializer(oled_sync_ack),
+// clang-format on
+
+#    else // SPLIT_OLED_MASTER_RENDER
+
+#        define TRANSACTIONS_OLED_MASTER() TRANSACTION_HANDLER_MASTER_DEFERRABLE(oled, SPLIT_OLED_MAX_DEFER_MS)
+#        define TRANSACTIONS_OLED_SLAVE() TRANSACTION_HANDLER_SLAVE(oled)
+#        define TRANSACTIONS_OLED_REGISTRATIONS [PUT_OLED] = trans_initiator2target_initializer(current_oled_state),
+
+#    endif // SPLIT_OLED_MASTER_RENDER
 
 #else // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
@@ -688,7 +867,7 @@ static void st7565_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
     }
 }
 
-#    define TRANSACTIONS_ST7565_MASTER() TRANSACTION_HANDLER_MASTER(st7565)
+#    define TRANSACTIONS_ST7565_MASTER() TRANSACTION_HANDLER_MASTER_DEFERRABLE(st7565, SPLIT_ST7565_MAX_DEFER_MS)
 #    define TRANSACTIONS_ST7565_SLAVE() TRANSACTION_HANDLER_SLAVE(st7565)
 #    define TRANSACTIONS_ST7565_REGISTRATIONS [PUT_ST7565] = trans_initiator2target_initializer(current_st7565_state),
 
@@ -844,7 +1023,7 @@ static void haptic_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
 }
 
 // clang-format off
-#    define TRANSACTIONS_HAPTIC_MASTER() TRANSACTION_HANDLER_MASTER(haptic)
+#    define TRANSACTIONS_HAPTIC_MASTER() TRANSACTION_HANDLER_MASTER_DEFERRABLE(haptic, SPLIT_HAPTIC_MAX_DEFER_MS)
 #    define TRANSACTIONS_HAPTIC_SLAVE() TRANSACTION_HANDLER_SLAVE(haptic)
 #    define TRANSACTIONS_HAPTIC_REGISTRATIONS [PUT_HAPTIC] = trans_initiator2target_initializer(haptic_sync),
 // clang-format on
@@ -873,7 +1052,7 @@ static void activity_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 }
 
 // clang-format off
-#    define TRANSACTIONS_ACTIVITY_MASTER() TRANSACTION_HANDLER_MASTER(activity)
+#    define TRANSACTIONS_ACTIVITY_MASTER() TRANSACTION_HANDLER_MASTER_DEFERRABLE(activity, SPLIT_ACTIVITY_MAX_DEFER_MS)
 #    define TRANSACTIONS_ACTIVITY_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(activity)
 #    define TRANSACTIONS_ACTIVITY_REGISTRATIONS [PUT_ACTIVITY] = trans_initiator2target_initializer(activity_sync),
 // clang-format on
@@ -954,7 +1133,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 };
 
-bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+static bool transactions_master_handlers(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
@@ -977,6 +1156,19 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     return true;
 }
 
+bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#ifdef SPLIT_ADAPTIVE_SYNC
+    split_transport_stats_t stats = transport_get_stats();
+    split_sync_cycle_start(&split_sync_state, stats.transactions, stats.failures);
+    bool okay = transactions_master_handlers(master_matrix, slave_matrix);
+    stats     = transport_get_stats();
+    split_sync_cycle_end(&split_sync_state, stats.transactions, stats.failures);
+    return okay;
+#else
+    return transactions_master_handlers(master_matrix, slave_matrix);
+#endif // SPLIT_ADAPTIVE_SYNC
+}
+
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     TRANSACTIONS_SLAVE_MATRIX_SLAVE();
     TRANSACTIONS_MASTER_MATRIX_SLAVE();
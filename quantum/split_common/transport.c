@@ -41,6 +41,8 @@ STATIC_ASSERT(sizeof(split_shared_memory_t) <= I2C_SLAVE_REG_COUNT, "split_share
 
 split_shared_memory_t *const split_shmem = (split_shared_memory_t *)i2c_slave_reg;
 
+static split_transport_stats_t transport_stats;
+
 void transport_master_init(void) {
     i2c_init();
 }
@@ -60,7 +62,7 @@ i2c_status_t transport_trigger_callback(int8_t id) {
     return i2c_write_register(SLAVE_I2C_ADDRESS, trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size, SLAVE_I2C_TIMEOUT);
 }
 
-bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+static bool transport_transact(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
     i2c_status_t              status;
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
@@ -69,6 +71,7 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
         if ((status = i2c_write_register(SLAVE_I2C_ADDRESS, trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), len, SLAVE_I2C_TIMEOUT)) < 0) {
             return false;
         }
+        transport_stats.bytes += len;
     }
 
     // If we need to execute a callback on the slave, do so
@@ -82,6 +85,7 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
             return false;
         }
         memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+        transport_stats.bytes += len;
     }
 
     return true;
@@ -94,6 +98,8 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 static split_shared_memory_t shared_memory;
 split_shared_memory_t *const split_shmem = &shared_memory;
 
+static split_transport_stats_t transport_stats;
+
 void transport_master_init(void) {
     soft_serial_initiator_init();
 }
@@ -101,7 +107,7 @@ void transport_slave_init(void) {
     soft_serial_target_init();
 }
 
-bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+static bool transport_transact(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
         size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
@@ -111,6 +117,8 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
     if (!soft_serial_transaction(id)) {
         return false;
     }
+    // The whole registered buffers are always transferred
+    transport_stats.bytes += trans->initiator2target_buffer_size + trans->target2initiator_buffer_size;
 
     if (target2initiator_length > 0) {
         size_t len = trans->target2initiator_buffer_size < target2initiator_length ? trans->target2initiator_buffer_size : target2initiator_length;
@@ -122,6 +130,24 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 
 #endif // USE_I2C
 
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    bool okay = transport_transact(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+    if (okay) {
+        transport_stats.transactions++;
+    } else {
+        transport_stats.failures++;
+    }
+    return okay;
+}
+
+split_transport_stats_t transport_get_stats(void) {
+    return transport_stats;
+}
+
+void transport_reset_stats(void) {
+    memset(&transport_stats, 0, sizeof(transport_stats));
+}
+
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     return transactions_master(master_matrix, slave_matrix);
 }
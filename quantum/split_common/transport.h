@@ -40,6 +40,16 @@ void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
 bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
 
+typedef struct _split_transport_stats_t {
+    uint32_t transactions; // transactions completed
+    uint32_t failures;     // transactions failed
+    uint32_t bytes;        // bytes transferred, including the unused part of fixed size serial transfers
+} split_transport_stats_t;
+
+// Statistics of the transactions executed by this half since boot, or the last reset
+split_transport_stats_t transport_get_stats(void);
+void                    transport_reset_stats(void);
+
 #ifdef ENCODER_ENABLE
 #    include "encoder.h"
 #endif // ENCODER_ENABLE
@@ -52,6 +62,25 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 #    include "rgblight.h"
 #endif // RGBLIGHT_ENABLE
 
+#if defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE) && defined(SPLIT_OLED_MASTER_RENDER)
+#    include "oled_driver.h"
+#    include "split_oled_rle.h"
+
+// Worst case size of a run-length encoded display block, plus its block index and length
+#    define SPLIT_OLED_RECORD_MAX_SIZE (2 + SPLIT_OLED_RLE_MAX_SIZE(OLED_BLOCK_SIZE))
+
+#    ifndef SPLIT_OLED_PAYLOAD_SIZE
+// a few blocks per transaction, serial transport always sends the full payload
+#        define SPLIT_OLED_PAYLOAD_SIZE (SPLIT_OLED_RECORD_MAX_SIZE * 4 > 250 ? SPLIT_OLED_RECORD_MAX_SIZE : SPLIT_OLED_RECORD_MAX_SIZE * 4)
+#    endif // SPLIT_OLED_PAYLOAD_SIZE
+
+// Published by PUT_OLED_BLOCKS, then sealed by a split_oled_commit_t in PUT_OLED_BLOCKS_COMMIT
+typedef struct _split_oled_sync_t {
+    uint8_t length;
+    uint8_t data[SPLIT_OLED_PAYLOAD_SIZE]; // records of block index, encoded length, encoded block
+} split_oled_sync_t;
+#endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE) && defined(SPLIT_OLED_MASTER_RENDER)
+
 typedef struct _split_slave_matrix_sync_t {
     uint8_t      checksum;
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
@@ -200,6 +229,11 @@ typedef struct _split_shared_memory_t {
 
 #if defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
     uint8_t current_oled_state;
+#    ifdef SPLIT_OLED_MASTER_RENDER
+    split_oled_sync_t   oled_sync;
+    split_oled_commit_t oled_sync_commit;
+    uint8_t             oled_sync_ack;
+#    endif // SPLIT_OLED_MASTER_RENDER
 #endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
 #if defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
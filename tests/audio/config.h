@@ -16,3 +16,5 @@
 #pragma once
 
 #include "test_common.h"
+
+#define AUDIO_VOICES
@@ -20,6 +20,10 @@
 #include "keyboard_report_util.hpp"
 #include "test_common.hpp"
 
+extern "C" {
+void set_time(uint32_t t);
+}
+
 namespace {
 
 class AudioTest : public TestFixture {
@@ -115,4 +119,50 @@ TEST_F(AudioTest, BpmConversion) {
     }
 }
 
+TEST_F(AudioTest, VibratoFollowsLut) {
+    set_voice(vibrating);
+    voice_set_vibrato_rate(0.125);
+
+    // At rate 0.125, the vibrato advances one lut entry every 12.5 ms; sample
+    // each entry halfway through to stay clear of the bin edges.
+    voice_set_vibrato_strength(1.0);
+    for (uint32_t t = 5; t < 4000; t += 25) {
+        SCOPED_TRACE("time " + testing::PrintToString(t) + " ms");
+        set_time(t);
+        const float expected = 440.0f * vibrato_lut[(2 * t / 25) % VIBRATO_LUT_LENGTH];
+        ASSERT_NEAR(voice_envelope(440.0f), expected, 0.01f);
+    }
+
+    voice_set_vibrato_strength(0.5);
+    for (uint32_t t = 5; t < 4000; t += 25) {
+        SCOPED_TRACE("time " + testing::PrintToString(t) + " ms");
+        set_time(t);
+        const float expected = 440.0f * std::pow(vibrato_lut[(2 * t / 25) % VIBRATO_LUT_LENGTH], 0.5f);
+        ASSERT_NEAR(voice_envelope(440.0f), expected, 0.01f);
+    }
+
+    voice_set_vibrato_strength(0);
+    EXPECT_FLOAT_EQ(voice_envelope(440.0f), 440.0f);
+
+    set_voice(default_voice);
+}
+
+TEST_F(AudioTest, VibratoRateIsClamped) {
+    set_voice(vibrating);
+    voice_set_vibrato_strength(1.0);
+    voice_set_vibrato_rate(0.0001);
+
+    // The fastest supported rate advances one lut entry every millisecond,
+    // instead of overflowing and jumping around in it.
+    for (uint32_t t = 1000; t < 65000; t += 997) {
+        SCOPED_TRACE("time " + testing::PrintToString(t) + " ms");
+        set_time(t);
+        const float expected = 440.0f * vibrato_lut[t % VIBRATO_LUT_LENGTH];
+        ASSERT_NEAR(voice_envelope(440.0f), expected, 0.01f);
+    }
+
+    voice_set_vibrato_rate(0.125);
+    set_voice(default_voice);
+}
+
 } // namespace
@@ -0,0 +1,25 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// Several overrides per trigger, out of trigger order, to exercise the index
+const key_override_t shift_c_override     = ko_make_basic(MOD_MASK_SHIFT, KC_C, KC_X);
+const key_override_t shift_b_override     = ko_make_basic(MOD_MASK_SHIFT, KC_B, KC_Y);
+const key_override_t shift_b_shadowed     = ko_make_basic(MOD_MASK_SHIFT, KC_B, KC_Z);
+const key_override_t ctrl_c_override      = ko_make_basic(MOD_MASK_CTRL, KC_C, KC_V);
+const key_override_t gui_alt_only         = ko_make_basic(MOD_MASK_GUI | MOD_BIT(KC_LALT), KC_NO, KC_ESC);
+const key_override_t shift_a_override     = ko_make_basic(MOD_MASK_SHIFT, KC_A, KC_W);
+const key_override_t any_mod_b_override   = ko_make_with_layers_negmods_and_options(MOD_MASK_CSAG, KC_B, KC_U, ~0, 0, ko_options_default | ko_option_one_mod);
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    &shift_c_override,
+    &shift_b_override,
+    &shift_b_shadowed,
+    &ctrl_c_override,
+    &gui_alt_only,
+    &shift_a_override,
+    &any_mod_b_override,
+};
+// clang-format on
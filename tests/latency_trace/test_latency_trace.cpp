@@ -0,0 +1,117 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+
+class LatencyTrace : public TestFixture {
+   public:
+    void SetUp() override {
+        latency_trace_reset();
+    }
+};
+
+TEST_F(LatencyTrace, PlainKeyIsTracedWithinOneScan) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    for (uint8_t stage = 0; stage < LATENCY_TRACE_STAGE_COUNT; stage++) {
+        const latency_trace_histogram_t *histogram = latency_trace_get_histogram((latency_trace_stage_t)stage);
+        EXPECT_EQ(histogram->count, 2);
+        EXPECT_LT(histogram->max, 1000);
+    }
+    EXPECT_EQ(latency_trace_get_counters().dropped, 0);
+    EXPECT_EQ(latency_trace_get_counters().unreported, 0);
+}
+
+TEST_F(LatencyTrace, TapHoldKeyIsQueuedUntilResolved) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, LSFT_T(KC_P));
+
+    set_keymap({key});
+
+    EXPECT_NO_REPORT(driver);
+    key.press();
+    run_one_scan_loop();
+    idle_for(50);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // the press waits in the tapping buffer until the release resolves it as a tap
+    const latency_trace_histogram_t *queue = latency_trace_get_histogram(LATENCY_TRACE_STAGE_QUEUE);
+    EXPECT_EQ(queue->count, 2);
+    EXPECT_GE(queue->max, 50000);
+    EXPECT_LE(queue->max, 52000);
+    EXPECT_LT(queue->min, 1000);
+
+    const latency_trace_histogram_t *process = latency_trace_get_histogram(LATENCY_TRACE_STAGE_PROCESS);
+    EXPECT_EQ(process->count, 2);
+    EXPECT_LT(process->max, 1000);
+
+    const latency_trace_histogram_t *total = latency_trace_get_histogram(LATENCY_TRACE_STAGE_TOTAL);
+    EXPECT_EQ(total->max, queue->max);
+}
+
+TEST_F(LatencyTrace, KeyWithoutReportIsCountedSeparately) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_NO);
+
+    set_keymap({key});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(latency_trace_get_histogram(LATENCY_TRACE_STAGE_TOTAL)->count, 0);
+    EXPECT_EQ(latency_trace_get_counters().unreported, 2);
+}
+
+TEST_F(LatencyTrace, RawHidRequests) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    uint8_t data[32] = {LATENCY_TRACE_RAW_HID_COMMAND, 0x01, LATENCY_TRACE_STAGE_TOTAL};
+    EXPECT_TRUE(latency_trace_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[1], 0x01);
+    EXPECT_EQ(data[3], 2); // count, little endian
+    EXPECT_EQ(data[4], 0);
+
+    uint8_t reset[32] = {LATENCY_TRACE_RAW_HID_COMMAND, 0x04};
+    EXPECT_TRUE(latency_trace_raw_hid_receive(reset, sizeof(reset)));
+    EXPECT_EQ(latency_trace_get_histogram(LATENCY_TRACE_STAGE_TOTAL)->count, 0);
+
+    uint8_t invalid_stage[32] = {LATENCY_TRACE_RAW_HID_COMMAND, 0x01, LATENCY_TRACE_STAGE_COUNT};
+    EXPECT_TRUE(latency_trace_raw_hid_receive(invalid_stage, sizeof(invalid_stage)));
+    EXPECT_EQ(invalid_stage[1], 0xFF);
+
+    uint8_t other[32] = {0x01, 0x01};
+    EXPECT_FALSE(latency_trace_raw_hid_receive(other, sizeof(other)));
+}
@@ -0,0 +1,18 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+static void tap_three(void) {
+    tap_code(KC_3);
+}
+
+// clang-format off
+const leader_entry_t leader_dictionary[] PROGMEM = {
+    LEADER_KEYCODE(KC_1, KC_A),
+    LEADER_KEYCODE(KC_2, KC_A, KC_B),
+    LEADER_ACTION(tap_three, KC_C),
+    LEADER_STRING("x", KC_D, KC_D),
+    LEADER_KEYCODE(KC_6, KC_E, KC_E, KC_E, KC_E, KC_E, KC_E),
+};
+// clang-format on
@@ -0,0 +1,12 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// clang-format off
+const leader_entry_t leader_dictionary[] PROGMEM = {
+    LEADER_KEYCODE(KC_2, KC_A, KC_B),
+    LEADER_KEYCODE(KC_3, KC_C),
+    LEADER_KEYCODE(KC_1, KC_A),
+};
+// clang-format on
@@ -0,0 +1,5 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+MATRIX_EVENT_QUEUE_ENABLE = yes
+LATENCY_TRACE_ENABLE = yes
@@ -0,0 +1,48 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "matrix_event_queue.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+
+class MatrixEventQueueLatencyTrace : public TestFixture {
+   public:
+    void SetUp() override {
+        latency_trace_reset();
+    }
+};
+
+TEST_F(MatrixEventQueueLatencyTrace, ScanIsTracedWhenQueued) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    // the press is scanned right away, but the main loop only gets to it after a stall
+    key.press();
+    matrix_event_queue_scan();
+    advance_time(20);
+
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(latency_trace_get_histogram(LATENCY_TRACE_STAGE_SCAN)->count, 1);
+    EXPECT_LT(latency_trace_get_histogram(LATENCY_TRACE_STAGE_SCAN)->max, 1000);
+    EXPECT_GE(latency_trace_get_histogram(LATENCY_TRACE_STAGE_QUEUE)->min, 20000);
+    EXPECT_GE(latency_trace_get_histogram(LATENCY_TRACE_STAGE_TOTAL)->min, 20000);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
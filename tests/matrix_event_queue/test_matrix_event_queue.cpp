@@ -0,0 +1,104 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "matrix_event_queue.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+
+class MatrixEventQueue : public TestFixture {};
+
+TEST_F(MatrixEventQueue, KeysAreProcessedInScanOrder) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+
+    set_keymap({key_a, key_b});
+
+    // both changes are seen by separate scans before the main loop gets to run
+    key_a.press();
+    matrix_event_queue_scan();
+    key_b.press();
+    matrix_event_queue_scan();
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    key_b.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixEventQueue, EventsKeepTheirScanTime) {
+    TestDriver driver;
+    auto       mod_tap_key = KeymapKey(0, 0, 0, LSFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // the release is scanned in time for a tap, but only processed after the main loop
+    // was stalled for longer than the tapping term
+    advance_time(20);
+    mod_tap_key.release();
+    matrix_event_queue_scan();
+    advance_time(TAPPING_TERM + 100);
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixEventQueue, FullQueueDoesNotOverflow) {
+    TestDriver             driver;
+    std::vector<KeymapKey> keys;
+
+    // more changes than fit in the queue, split over press and release
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            keys.push_back(KeymapKey(0, col, row, KC_NO));
+        }
+    }
+    ASSERT_GT(keys.size() * 2, MATRIX_EVENT_QUEUE_SIZE);
+    for (auto &key : keys) {
+        add_key(key);
+    }
+
+    EXPECT_NO_REPORT(driver);
+    for (auto &key : keys) {
+        key.press();
+        matrix_event_queue_scan();
+        key.release();
+        matrix_event_queue_scan();
+    }
+
+    uint16_t       count = 0;
+    matrix_event_t event;
+    while (matrix_event_queue_pop(&event)) {
+        count++;
+    }
+    EXPECT_EQ(count, MATRIX_EVENT_QUEUE_SIZE);
+
+    // the debounced state of every key is back to released, nothing else is queued
+    EXPECT_FALSE(matrix_event_queue_scan());
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
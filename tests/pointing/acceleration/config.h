@@ -0,0 +1,12 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define POINTING_DEVICE_ACCELERATION_ENABLE
+#define POINTING_DEVICE_ACCELERATION_CURVE \
+    { {4, POINTING_DEVICE_ACCEL_GAIN(0, 128)}, {20, POINTING_DEVICE_ACCEL_GAIN(2, 128)} }
+#define POINTING_DEVICE_ACCELERATION_SCROLL_CURVE \
+    { {0, POINTING_DEVICE_ACCEL_GAIN(3, 0)} }
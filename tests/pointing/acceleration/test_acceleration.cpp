@@ -0,0 +1,138 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+extern "C" {
+#include "pointing_device.h"
+}
+
+using testing::_;
+
+class PointingAcceleration : public TestFixture {
+   protected:
+    void SetUp() override {
+        pointing_device_set_acceleration_enabled(true);
+    }
+};
+
+static const pointing_device_accel_point_t test_curve[] = {
+    {4, POINTING_DEVICE_ACCEL_GAIN(1, 0)},
+    {12, POINTING_DEVICE_ACCEL_GAIN(3, 0)},
+};
+
+TEST_F(PointingAcceleration, GainIsInterpolatedAndClampedToCurve) {
+    EXPECT_EQ(pointing_device_accel_gain(test_curve, 2, 0), 256);
+    EXPECT_EQ(pointing_device_accel_gain(test_curve, 2, 4), 256);
+    EXPECT_EQ(pointing_device_accel_gain(test_curve, 2, 8), 512);
+    EXPECT_EQ(pointing_device_accel_gain(test_curve, 2, 12), 768);
+    EXPECT_EQ(pointing_device_accel_gain(test_curve, 2, 1000), 768);
+    EXPECT_EQ(pointing_device_accel_gain(NULL, 0, 10), 256);
+}
+
+TEST_F(PointingAcceleration, FractionsAreCarriedPerAxis) {
+    static const pointing_device_accel_point_t half[] = {{0, POINTING_DEVICE_ACCEL_GAIN(0, 128)}};
+    pointing_device_accel_t                    accel  = {.curve = half, .curve_length = 1};
+
+    int32_t outputs_x = 0, outputs_y = 0;
+    for (int i = 0; i < 8; i++) {
+        int32_t x = 1, y = -1;
+        pointing_device_accel_apply(&accel, &x, &y);
+        outputs_x += x;
+        outputs_y += y;
+    }
+    // A gain of 0.5 over 8 counts yields exactly 4 in each direction.
+    EXPECT_EQ(outputs_x, 4);
+    EXPECT_EQ(outputs_y, -4);
+
+    pointing_device_accel_reset(&accel);
+    EXPECT_EQ(accel.remainder_a, 0);
+    EXPECT_EQ(accel.remainder_b, 0);
+}
+
+TEST_F(PointingAcceleration, LargeMotionDoesNotOverflow) {
+    static const pointing_device_accel_point_t triple[] = {{0, POINTING_DEVICE_ACCEL_GAIN(3, 0)}};
+    pointing_device_accel_t                    accel    = {.curve = triple, .curve_length = 1};
+
+    int32_t x = 20000, y = -20000;
+    pointing_device_accel_apply(&accel, &x, &y);
+    EXPECT_EQ(x, 60000);
+    EXPECT_EQ(y, -60000);
+
+    // limited to the extended report range first
+    x = INT32_MAX;
+    y = INT32_MIN;
+    pointing_device_accel_apply(&accel, &x, &y);
+    EXPECT_EQ(x, 32767 * 3);
+    EXPECT_EQ(y, -32767 * 3);
+    EXPECT_EQ(accel.remainder_a, 0);
+    EXPECT_EQ(accel.remainder_b, 0);
+
+    // the largest gain does not overflow either
+    static const pointing_device_accel_point_t largest[] = {{0, UINT16_MAX}};
+    accel                                                = (pointing_device_accel_t){.curve = largest, .curve_length = 1};
+
+    x = 32767;
+    y = -32767;
+    pointing_device_accel_apply(&accel, &x, &y);
+    EXPECT_EQ(x, (32767 * 65535) >> 8);
+    EXPECT_EQ(y, -((32767 * 65535 + 255) >> 8));
+    EXPECT_EQ(accel.remainder_a + accel.remainder_b, 256);
+}
+
+TEST_F(PointingAcceleration, FastMotionIsAccelerated) {
+    TestDriver driver;
+
+    pd_set_x(20);
+    pd_set_y(-20);
+    // Speed 30 is beyond the last point, gain 2.5.
+    EXPECT_MOUSE_REPORT(driver, (50, -50, 0, 0, 0));
+    run_one_scan_loop();
+    pd_clear_movement();
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAcceleration, SlowMotionIsCarried) {
+    TestDriver driver;
+
+    testing::InSequence s;
+    pd_set_x(1);
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0));
+    // Gain 0.5, so the first count is only emitted once the fraction has accumulated.
+    run_one_scan_loop();
+    run_one_scan_loop();
+    pd_clear_movement();
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAcceleration, ScrollUsesItsOwnCurve) {
+    TestDriver driver;
+
+    pd_set_v(2);
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 6, 0));
+    run_one_scan_loop();
+    pd_clear_movement();
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAcceleration, CanBeDisabled) {
+    TestDriver driver;
+
+    pointing_device_set_acceleration_enabled(false);
+    pd_set_x(20);
+    EXPECT_MOUSE_REPORT(driver, (20, 0, 0, 0, 0));
+    run_one_scan_loop();
+    pd_clear_movement();
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
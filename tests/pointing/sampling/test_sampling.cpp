@@ -0,0 +1,87 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+extern "C" {
+#include "pointing_device.h"
+}
+
+using testing::_;
+
+class PointingSampling : public TestFixture {
+   protected:
+    void SetUp() override {
+        pd_clear_movement();
+        pointing_device_sampling_clear();
+    }
+};
+
+TEST_F(PointingSampling, SamplesAccumulateUntilDrained) {
+    report_mouse_t report = {};
+
+    pd_set_x(3);
+    pd_set_y(-2);
+    pointing_device_sample();
+    pointing_device_sample();
+    pointing_device_sample();
+    pd_clear_movement();
+
+    report = pointing_device_sampling_drain(report);
+    EXPECT_EQ(report.x, 9);
+    EXPECT_EQ(report.y, -6);
+
+    report = pointing_device_sampling_drain(report);
+    EXPECT_EQ(report.x, 0);
+    EXPECT_EQ(report.y, 0);
+}
+
+TEST_F(PointingSampling, OverflowIsCarriedToNextReport) {
+    report_mouse_t report = {};
+
+    pd_set_x(100);
+    pd_set_v(-100);
+    pointing_device_sample();
+    pointing_device_sample();
+    pd_clear_movement();
+
+    report = pointing_device_sampling_drain(report);
+    EXPECT_EQ(report.x, MOUSE_REPORT_XY_MAX);
+    EXPECT_EQ(report.v, MOUSE_REPORT_HV_MIN);
+
+    report = pointing_device_sampling_drain(report);
+    EXPECT_EQ(report.x, 200 - MOUSE_REPORT_XY_MAX);
+    EXPECT_EQ(report.v, -200 - MOUSE_REPORT_HV_MIN);
+}
+
+TEST_F(PointingSampling, SensorButtonsReplacePreviousSensorButtons) {
+    report_mouse_t report = {.buttons = 0x04};
+
+    pd_press_button(POINTING_DEVICE_BUTTON1);
+    pointing_device_sample();
+    report = pointing_device_sampling_drain(report);
+    EXPECT_EQ(report.buttons, 0x05);
+
+    pd_release_button(POINTING_DEVICE_BUTTON1);
+    pointing_device_sample();
+    report = pointing_device_sampling_drain(report);
+    EXPECT_EQ(report.buttons, 0x04);
+}
+
+TEST_F(PointingSampling, ThrottledTaskReportsAllSampledMotion) {
+    TestDriver driver;
+
+    // Sampling continues every loop while the report is throttled, so no motion is lost.
+    testing::InSequence s;
+    pd_set_x(2);
+    EXPECT_MOUSE_REPORT(driver, (2, 0, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (2 * (POINTING_DEVICE_TASK_THROTTLE_MS - 1), 0, 0, 0, 0));
+    idle_for(POINTING_DEVICE_TASK_THROTTLE_MS);
+    pd_clear_movement();
+    idle_for(POINTING_DEVICE_TASK_THROTTLE_MS * 2);
+
+    VERIFY_AND_CLEAR(driver);
+}
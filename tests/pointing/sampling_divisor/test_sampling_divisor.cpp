@@ -0,0 +1,45 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+extern "C" {
+#include "pointing_device.h"
+}
+
+class PointingSamplingDivisor : public TestFixture {
+   protected:
+    void SetUp() override {
+        pd_clear_movement();
+        pointing_device_sampling_clear();
+    }
+};
+
+TEST_F(PointingSamplingDivisor, RemainderIsCarriedToNextReport) {
+    report_mouse_t report = {};
+
+    pd_set_x(3);
+    pd_set_y(-3);
+    pointing_device_sample();
+    pointing_device_sample();
+    pointing_device_sample();
+
+    // 9 counts make 2 report units, the remaining count is kept
+    report = pointing_device_sampling_drain(report);
+    EXPECT_EQ(report.x, 2);
+    EXPECT_EQ(report.y, -2);
+
+    pointing_device_sample();
+    pd_clear_movement();
+
+    report = pointing_device_sampling_drain(report);
+    EXPECT_EQ(report.x, 1);
+    EXPECT_EQ(report.y, -1);
+
+    report = pointing_device_sampling_drain(report);
+    EXPECT_EQ(report.x, 0);
+    EXPECT_EQ(report.y, 0);
+}
@@ -0,0 +1,9 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+#include "test_qp_comms_spi.h"
+
+#define QUANTUM_PAINTER_PIXDATA_ASYNC 1
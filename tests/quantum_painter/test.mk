@@ -0,0 +1,17 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Only the Quantum Painter comms and drawing layers are built; the SPI driver, pins and panel are mocked by the tests
+OPT_DEFS += -DQUANTUM_PAINTER_SPI_ENABLE -DQUANTUM_PAINTER_SPI_DC_RESET_ENABLE
+
+COMMON_VPATH += \
+    $(QUANTUM_PATH)/painter \
+    $(DRIVER_PATH)/painter/comms
+
+SRC += \
+    $(QUANTUM_PATH)/painter/qp_comms.c \
+    $(QUANTUM_PATH)/painter/qp_stream.c \
+    $(QUANTUM_PATH)/painter/qp_draw_core.c \
+    $(QUANTUM_PATH)/painter/qp_draw_circle.c \
+    $(QUANTUM_PATH)/painter/qp_draw_ellipse.c \
+    $(DRIVER_PATH)/painter/comms/qp_comms_spi.c
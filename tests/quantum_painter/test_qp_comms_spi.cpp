@@ -0,0 +1,167 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <ostream>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "spi_master.h"
+#include "qp_comms.h"
+#include "qp_comms_spi.h"
+}
+
+#define CS_PIN 1
+#define DC_PIN 2
+
+// Number of spi_transmit_busy() polls an asynchronous transfer stays in flight for
+#define ASYNC_TRANSFER_POLLS 3
+
+enum bus_event_type_t { START, STOP, WRITE, TRANSMIT, TRANSMIT_ASYNC, ASYNC_DONE, CS_HIGH, CS_LOW, DC_HIGH, DC_LOW };
+
+struct bus_event_t {
+    bus_event_type_t type;
+    uint32_t         value;
+
+    bool operator==(const bus_event_t &other) const {
+        return type == other.type && value == other.value;
+    }
+};
+
+std::ostream &operator<<(std::ostream &os, const bus_event_t &event) {
+    static const char *names[] = {"START", "STOP", "WRITE", "TRANSMIT", "TRANSMIT_ASYNC", "ASYNC_DONE", "CS_HIGH", "CS_LOW", "DC_HIGH", "DC_LOW"};
+    return os << names[event.type] << "(" << event.value << ")";
+}
+
+// Dummy SPI backend, recording the bus activity in order. Anything touching the bus or a pin while an asynchronous
+// transfer is still in flight is counted as an overlap.
+static std::vector<bus_event_t> bus_events;
+static uint8_t                  async_polls_remaining = 0;
+static uint16_t                 overlaps              = 0;
+
+static void record(bus_event_type_t type, uint32_t value = 0) {
+    if (async_polls_remaining > 0) {
+        overlaps++;
+    }
+    bus_events.push_back({type, value});
+}
+
+extern "C" {
+void spi_init(void) {}
+
+bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
+    record(START);
+    return true;
+}
+
+spi_status_t spi_write(uint8_t data) {
+    record(WRITE, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    record(TRANSMIT, length);
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    record(TRANSMIT_ASYNC, length);
+    async_polls_remaining = ASYNC_TRANSFER_POLLS;
+    return SPI_STATUS_SUCCESS;
+}
+
+bool spi_transmit_busy(void) {
+    if (async_polls_remaining > 0 && --async_polls_remaining == 0) {
+        bus_events.push_back({ASYNC_DONE, 0});
+    }
+    return async_polls_remaining > 0;
+}
+
+void spi_stop(void) {
+    record(STOP);
+}
+
+void gpio_set_pin_output(pin_t pin) {}
+
+void gpio_write_pin_high(pin_t pin) {
+    record(pin == DC_PIN ? DC_HIGH : CS_HIGH);
+}
+
+void gpio_write_pin_low(pin_t pin) {
+    record(pin == DC_PIN ? DC_LOW : CS_LOW);
+}
+}
+
+class QuantumPainterSpiComms : public testing::Test {
+   protected:
+    qp_comms_spi_dc_reset_config_t comms_config  = {};
+    painter_driver_t               driver        = {};
+    painter_device_t               device        = &driver;
+    uint8_t                        pixdata[2500] = {};
+
+    void SetUp() override {
+        comms_config.spi_config.chip_select_pin = CS_PIN;
+        comms_config.spi_config.divisor         = 4;
+        comms_config.dc_pin                     = DC_PIN;
+        comms_config.reset_pin                  = NO_PIN;
+
+        driver.comms_vtable = &spi_comms_with_dc_vtable.base;
+        driver.comms_config = &comms_config;
+        driver.validate_ok  = true;
+
+        bus_events.clear();
+        async_polls_remaining = 0;
+        overlaps              = 0;
+    }
+};
+
+TEST_F(QuantumPainterSpiComms, AsyncSendReturnsWithTransferInFlight) {
+    qp_comms_start(device);
+    EXPECT_EQ(qp_comms_send_async(device, pixdata, 100), 100);
+    EXPECT_GT(async_polls_remaining, 0);
+
+    qp_comms_stop(device);
+
+    std::vector<bus_event_t> expected = {{START, 0}, {DC_HIGH, 0}, {TRANSMIT_ASYNC, 100}, {ASYNC_DONE, 0}, {STOP, 0}, {CS_HIGH, 0}};
+    EXPECT_EQ(bus_events, expected);
+    EXPECT_EQ(overlaps, 0);
+}
+
+TEST_F(QuantumPainterSpiComms, LargeSendsAreChunkedOneTransferAtATime) {
+    qp_comms_start(device);
+    EXPECT_EQ(qp_comms_send_async(device, pixdata, sizeof(pixdata)), sizeof(pixdata));
+    qp_comms_stop(device);
+
+    std::vector<bus_event_t> expected = {{START, 0}, {DC_HIGH, 0}, {TRANSMIT_ASYNC, 1024}, {ASYNC_DONE, 0}, {TRANSMIT_ASYNC, 1024}, {ASYNC_DONE, 0}, {TRANSMIT_ASYNC, 452}, {ASYNC_DONE, 0}, {STOP, 0}, {CS_HIGH, 0}};
+    EXPECT_EQ(bus_events, expected);
+    EXPECT_EQ(overlaps, 0);
+}
+
+TEST_F(QuantumPainterSpiComms, CommandsWaitForPixelData) {
+    static const uint8_t window[] = {0x00, 0x10, 0x00, 0x20};
+
+    qp_comms_start(device);
+    qp_comms_send_async(device, pixdata, 64);
+    // a viewport change, as sent by the TFT panels between blocks of pixel data
+    qp_comms_command_databuf(device, 0x2A, window, sizeof(window));
+    qp_comms_command(device, 0x2C);
+    qp_comms_send_async(device, pixdata, 64);
+    qp_comms_stop(device);
+
+    std::vector<bus_event_t> expected = {
+        {START, 0}, {DC_HIGH, 0}, {TRANSMIT_ASYNC, 64}, {ASYNC_DONE, 0}, {DC_LOW, 0}, {WRITE, 0x2A}, {DC_HIGH, 0}, {TRANSMIT, 4}, {DC_LOW, 0}, {WRITE, 0x2C}, {DC_HIGH, 0}, {TRANSMIT_ASYNC, 64}, {ASYNC_DONE, 0}, {STOP, 0}, {CS_HIGH, 0},
+    };
+    EXPECT_EQ(bus_events, expected);
+    EXPECT_EQ(overlaps, 0);
+}
+
+TEST_F(QuantumPainterSpiComms, SyncSendWaitsForPixelData) {
+    qp_comms_start(device);
+    qp_comms_send_async(device, pixdata, 64);
+    EXPECT_EQ(qp_comms_send(device, pixdata, 16), 16);
+    qp_comms_stop(device);
+
+    std::vector<bus_event_t> expected = {{START, 0}, {DC_HIGH, 0}, {TRANSMIT_ASYNC, 64}, {ASYNC_DONE, 0}, {DC_HIGH, 0}, {TRANSMIT, 16}, {STOP, 0}, {CS_HIGH, 0}};
+    EXPECT_EQ(bus_events, expected);
+    EXPECT_EQ(overlaps, 0);
+}
@@ -0,0 +1,339 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_draw.h"
+}
+
+#define CANVAS_SIZE 256
+#define CENTER 128
+
+// Dummy panel, rendering the pixel data it receives into a canvas. Every pixel sent is checked against the colour
+// drawn, and every viewport has to receive exactly as many pixels as it covers.
+typedef std::vector<uint8_t> pixel_set_t;
+
+static pixel_set_t canvas(CANVAS_SIZE * CANVAS_SIZE);
+static uint16_t    window_left, window_top, window_right, window_bottom;
+static uint32_t    window_pixels;
+static uint32_t    bad_pixels;
+static uint32_t    bad_windows;
+static uint16_t    drawn_rgb565;
+
+static uint32_t window_size(void) {
+    return (window_right - window_left + 1) * (window_bottom - window_top + 1);
+}
+
+static void close_window(void) {
+    if (window_pixels != window_size()) {
+        bad_windows++;
+    }
+}
+
+static bool dummy_comms_start(painter_device_t device) {
+    return true;
+}
+
+static void dummy_comms_stop(painter_device_t device) {}
+
+static bool dummy_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    close_window();
+    window_left   = left;
+    window_top    = top;
+    window_right  = right;
+    window_bottom = bottom;
+    window_pixels = 0;
+    return true;
+}
+
+static bool dummy_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    const uint16_t *pixels = (const uint16_t *)pixel_data;
+    uint16_t        width  = window_right - window_left + 1;
+    for (uint32_t i = 0; i < native_pixel_count; ++i, ++window_pixels) {
+        if (pixels[i] != drawn_rgb565 || window_pixels >= window_size()) {
+            bad_pixels++;
+            continue;
+        }
+        canvas[(window_top + window_pixels / width) * CANVAS_SIZE + window_left + window_pixels % width] = 1;
+    }
+    return true;
+}
+
+// Each bpp gets a distinct byte pattern, so that misplaced bytes show up
+static bool dummy_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    for (int16_t i = 0; i < palette_size; ++i) {
+        qp_pixel_t hsv = palette[i];
+        switch (driver->native_bits_per_pixel) {
+            case 1:
+                palette[i].mono = (hsv.hsv888.v > 127) ? 1 : 0;
+                break;
+            case 16:
+                palette[i].rgb565 = (hsv.hsv888.h << 8) | hsv.hsv888.v;
+                break;
+            case 24:
+                palette[i].rgb888.r = hsv.hsv888.h;
+                palette[i].rgb888.g = hsv.hsv888.s;
+                palette[i].rgb888.b = hsv.hsv888.v;
+                break;
+        }
+    }
+    return true;
+}
+
+static bool dummy_append_pixels(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    for (uint32_t i = 0; i < pixel_count; ++i) {
+        uint32_t    pixel_num = pixel_offset + i;
+        qp_pixel_t *pixel     = &palette[palette_indices[i]];
+        switch (driver->native_bits_per_pixel) {
+            case 1:
+                if (pixel->mono) {
+                    target_buffer[pixel_num / 8] |= (1 << (pixel_num % 8));
+                } else {
+                    target_buffer[pixel_num / 8] &= ~(1 << (pixel_num % 8));
+                }
+                break;
+            case 16:
+                ((uint16_t *)target_buffer)[pixel_num] = pixel->rgb565;
+                break;
+            case 24:
+                target_buffer[pixel_num * 3 + 0] = pixel->rgb888.r;
+                target_buffer[pixel_num * 3 + 1] = pixel->rgb888.g;
+                target_buffer[pixel_num * 3 + 2] = pixel->rgb888.b;
+                break;
+        }
+    }
+    return true;
+}
+
+static const painter_comms_vtable_t dummy_comms_vtable = {
+    .comms_start = dummy_comms_start,
+    .comms_stop  = dummy_comms_stop,
+};
+
+static const painter_driver_vtable_t dummy_driver_vtable = {
+    .viewport        = dummy_viewport,
+    .pixdata         = dummy_pixdata,
+    .palette_convert = dummy_palette_convert,
+    .append_pixels   = dummy_append_pixels,
+};
+
+static void plot(pixel_set_t &pixels, int16_t x, int16_t y) {
+    pixels[y * CANVAS_SIZE + x] = 1;
+}
+
+static void plot_span(pixel_set_t &pixels, int16_t x0, int16_t x1, int16_t y) {
+    for (int16_t x = QP_MIN(x0, x1); x <= QP_MAX(x0, x1); ++x) {
+        plot(pixels, x, y);
+    }
+}
+
+// Reference rasterisers: qp_circle() and qp_ellipse() as they were before drawing whole runs at once, one point at a time
+static pixel_set_t reference_circle(int16_t cx, int16_t cy, uint16_t radius, bool filled) {
+    pixel_set_t pixels(CANVAS_SIZE * CANVAS_SIZE);
+
+    int16_t xcalc = 0;
+    int16_t ycalc = (int16_t)radius;
+    int16_t err   = ((5 - (radius >> 2)) >> 2);
+    while (true) {
+        int16_t x = xcalc, y = ycalc;
+        if (x == 0) {
+            plot(pixels, cx, cy + y);
+            plot(pixels, cx, cy - y);
+            if (filled) {
+                plot_span(pixels, cx - y, cx + y, cy);
+            } else {
+                plot(pixels, cx + y, cy);
+                plot(pixels, cx - y, cy);
+            }
+        } else if (x == y) {
+            if (filled) {
+                plot_span(pixels, cx - y, cx + y, cy + y);
+                plot_span(pixels, cx - y, cx + y, cy - y);
+            } else {
+                plot(pixels, cx + y, cy + y);
+                plot(pixels, cx - y, cy + y);
+                plot(pixels, cx + y, cy - y);
+                plot(pixels, cx - y, cy - y);
+            }
+        } else if (filled) {
+            plot_span(pixels, cx - x, cx + x, cy + y);
+            plot_span(pixels, cx - x, cx + x, cy - y);
+            plot_span(pixels, cx - y, cx + y, cy + x);
+            plot_span(pixels, cx - y, cx + y, cy - x);
+        } else {
+            plot(pixels, cx + x, cy + y);
+            plot(pixels, cx - x, cy + y);
+            plot(pixels, cx + x, cy - y);
+            plot(pixels, cx - x, cy - y);
+            plot(pixels, cx + y, cy + x);
+            plot(pixels, cx - y, cy + x);
+            plot(pixels, cx + y, cy - x);
+            plot(pixels, cx - y, cy - x);
+        }
+
+        if (xcalc >= ycalc) {
+            break;
+        }
+        xcalc++;
+        if (err < 0) {
+            err += (xcalc << 1) + 1;
+        } else {
+            ycalc--;
+            err += ((xcalc - ycalc) << 1) + 1;
+        }
+    }
+    return pixels;
+}
+
+static void reference_ellipse_points(pixel_set_t &pixels, int16_t cx, int16_t cy, int16_t dx, int16_t dy, bool filled) {
+    if (dx == 0) {
+        plot(pixels, cx, cy + dy);
+        plot(pixels, cx, cy - dy);
+    } else if (filled) {
+        plot_span(pixels, cx - dx, cx + dx, cy + dy);
+        plot_span(pixels, cx - dx, cx + dx, cy - dy);
+    } else {
+        plot(pixels, cx + dx, cy + dy);
+        plot(pixels, cx + dx, cy - dy);
+        plot(pixels, cx - dx, cy + dy);
+        plot(pixels, cx - dx, cy - dy);
+    }
+}
+
+static pixel_set_t reference_ellipse(int16_t cx, int16_t cy, uint16_t sizex, uint16_t sizey, bool filled) {
+    pixel_set_t pixels(CANVAS_SIZE * CANVAS_SIZE);
+
+    int32_t aa = ((int32_t)sizex) * ((int32_t)sizex);
+    int32_t bb = ((int32_t)sizey) * ((int32_t)sizey);
+    int32_t fa = 4 * aa;
+    int32_t fb = 4 * bb;
+
+    int16_t dx = 0;
+    int16_t dy = ((int16_t)sizey);
+    for (int32_t delta = (2 * bb) + (aa * (1 - (2 * sizey))); bb * dx <= aa * dy; dx++) {
+        reference_ellipse_points(pixels, cx, cy, dx, dy, filled);
+        if (delta >= 0) {
+            delta += fa * (1 - dy);
+            dy--;
+        }
+        delta += bb * (4 * dx + 6);
+    }
+
+    dx = sizex;
+    dy = 0;
+    for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); aa * dy <= bb * dx; dy++) {
+        reference_ellipse_points(pixels, cx, cy, dx, dy, filled);
+        if (delta >= 0) {
+            delta += fb * (1 - dx);
+            dx--;
+        }
+        delta += aa * (4 * dy + 6);
+    }
+    return pixels;
+}
+
+class QuantumPainterDraw : public testing::Test {
+   protected:
+    painter_driver_t driver = {};
+    painter_device_t device = &driver;
+
+    void SetUp() override {
+        driver.driver_vtable         = &dummy_driver_vtable;
+        driver.comms_vtable          = &dummy_comms_vtable;
+        driver.validate_ok           = true;
+        driver.panel_width           = CANVAS_SIZE;
+        driver.panel_height          = CANVAS_SIZE;
+        driver.native_bits_per_pixel = 16;
+
+        canvas.assign(CANVAS_SIZE * CANVAS_SIZE, 0);
+        window_left = window_top = 0;
+        window_right = window_bottom = 0;
+        window_pixels                = 1;
+        bad_pixels                   = 0;
+        bad_windows                  = 0;
+        drawn_rgb565                 = (0x55 << 8) | 0xAA;
+    }
+
+    pixel_set_t rendered(void) {
+        close_window();
+        window_pixels = window_size();
+
+        pixel_set_t pixels(CANVAS_SIZE * CANVAS_SIZE);
+        pixels.swap(canvas);
+        return pixels;
+    }
+};
+
+TEST_F(QuantumPainterDraw, CircleMatchesReference) {
+    for (uint16_t radius = 0; radius < 120; ++radius) {
+        for (bool filled : {false, true}) {
+            ASSERT_TRUE(qp_circle(device, CENTER, CENTER, radius, 0x55, 0xFF, 0xAA, filled));
+            EXPECT_TRUE(rendered() == reference_circle(CENTER, CENTER, radius, filled)) << "radius " << radius << (filled ? " filled" : " outline");
+        }
+    }
+    EXPECT_EQ(bad_pixels, 0);
+    EXPECT_EQ(bad_windows, 0);
+}
+
+TEST_F(QuantumPainterDraw, EllipseMatchesReference) {
+    for (uint16_t sizex = 1; sizex < 70; ++sizex) {
+        for (uint16_t sizey = 1; sizey < 70; ++sizey) {
+            for (bool filled : {false, true}) {
+                ASSERT_TRUE(qp_ellipse(device, CENTER, CENTER, sizex, sizey, 0x55, 0xFF, 0xAA, filled));
+                EXPECT_TRUE(rendered() == reference_ellipse(CENTER, CENTER, sizex, sizey, filled)) << sizex << "x" << sizey << (filled ? " filled" : " outline");
+            }
+        }
+    }
+    EXPECT_EQ(bad_pixels, 0);
+    EXPECT_EQ(bad_windows, 0);
+}
+
+// The fill is generated by replicating the first few pixels' bytes, and has to match appending every pixel individually
+static void expect_fill_matches_append(painter_device_t device, uint8_t hue, uint8_t sat, uint8_t val) {
+    painter_driver_t *driver   = (painter_driver_t *)device;
+    uint32_t          capacity = qp_internal_num_pixels_in_buffer(device);
+
+    for (uint32_t num_pixels : {1u, 2u, 7u, 8u, 9u, 13u, 100u, capacity - 1, capacity, capacity + 50}) {
+        memset(qp_internal_global_pixdata_buffer, 0x5A, QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE);
+        qp_internal_fill_pixdata(device, num_pixels, hue, sat, val);
+
+        uint32_t             expected_pixels = QP_MIN(num_pixels, capacity);
+        std::vector<uint8_t> expected(QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE, 0x5A);
+        qp_pixel_t           color       = {.hsv888 = {.h = hue, .s = sat, .v = val}};
+        uint8_t              palette_idx = 0;
+        driver->driver_vtable->palette_convert(device, 1, &color);
+        for (uint32_t i = 0; i < expected_pixels; ++i) {
+            driver->driver_vtable->append_pixels(device, expected.data(), &color, i, 1, &palette_idx);
+        }
+
+        // Only the bits covered by the requested pixels are compared
+        uint32_t bits = expected_pixels * driver->native_bits_per_pixel;
+        for (uint32_t i = 0; i < (bits + 7) / 8; ++i) {
+            uint8_t mask = (i < bits / 8) ? 0xFF : (uint8_t)((1 << (bits % 8)) - 1);
+            EXPECT_EQ(qp_internal_global_pixdata_buffer[i] & mask, expected[i] & mask) << driver->native_bits_per_pixel << "bpp, " << num_pixels << " pixels, byte " << i;
+        }
+    }
+}
+
+TEST_F(QuantumPainterDraw, FillPixdata1bpp) {
+    driver.native_bits_per_pixel = 1;
+    expect_fill_matches_append(device, 0, 0, 255);
+    expect_fill_matches_append(device, 0, 0, 0);
+}
+
+TEST_F(QuantumPainterDraw, FillPixdata16bpp) {
+    driver.native_bits_per_pixel = 16;
+    expect_fill_matches_append(device, 0x12, 0x34, 0x56);
+}
+
+TEST_F(QuantumPainterDraw, FillPixdata24bpp) {
+    driver.native_bits_per_pixel = 24;
+    expect_fill_matches_append(device, 0x12, 0x34, 0x56);
+}
@@ -265,6 +265,38 @@ TEST_F(RepeatKey, AcrossLayers) {
     testing::Mock::VerifyAndClearExpectations(&driver);
 }
 
+// Tests that a key buffered while a layer-tap key is undecided is seen with its
+// layer 1 keycode once the layer-tap key settles as hold, producing "bb".
+TEST_F(RepeatKey, AfterLayerTapHold) {
+    TestDriver driver;
+    KeymapKey  key_repeat(0, 0, 0, QK_REP);
+    KeymapKey  key_lt_1(0, 1, 0, LT(1, KC_T));
+    KeymapKey  regular_key(0, 2, 0, KC_A);
+    set_keymap({// Layer 0.
+                key_repeat, key_lt_1, regular_key,
+                // Layer 1.
+                KeymapKey{1, 0, 0, KC_TRNS}, KeymapKey{1, 1, 0, KC_TRNS}, KeymapKey{1, 2, 0, KC_B}});
+
+    // Allow any number of empty reports.
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    ExpectString(driver, "bb");
+
+    key_lt_1.press();
+    run_one_scan_loop();
+    regular_key.press(); // Buffered until the layer-tap key is decided.
+    run_one_scan_loop();
+    idle_for(TAPPING_TERM); // The layer-tap key settles as hold.
+    EXPECT_KEYCODE_EQ(get_last_keycode(), KC_B);
+
+    regular_key.release();
+    run_one_scan_loop();
+    key_lt_1.release();
+    run_one_scan_loop();
+    tap_key(key_repeat);
+
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
 // Tests "A(down), Repeat(down), A(up), Repeat(up), Repeat" produces "aaa".
 TEST_F(RepeatKey, RollingToRepeat) {
     TestDriver driver;
@@ -224,3 +224,50 @@ TEST_F(DefaultTapHold, tap_and_hold_mod_tap_hold_key) {
     run_one_scan_loop();
     VERIFY_AND_CLEAR(driver);
 }
+
+TEST_F(DefaultTapHold, roll_over_full_waiting_buffer_while_mod_tap_key_is_held) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_hold_key = KeymapKey(0, 0, 0, SFT_T(KC_P));
+    auto       regular_keys     = std::vector<KeymapKey>{KeymapKey(0, 1, 0, KC_A), KeymapKey(0, 2, 0, KC_B), KeymapKey(0, 3, 0, KC_C), KeymapKey(0, 4, 0, KC_D)};
+
+    set_keymap({mod_tap_hold_key, regular_keys[0], regular_keys[1], regular_keys[2], regular_keys[3]});
+
+    /* Press mod-tap-hold key. */
+    EXPECT_NO_REPORT(driver);
+    mod_tap_hold_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Tap regular keys until the waiting buffer is full. */
+    EXPECT_NO_REPORT(driver);
+    for (auto &key : regular_keys) {
+        key.press();
+        run_one_scan_loop();
+        if (&key != &regular_keys.back()) {
+            key.release();
+            run_one_scan_loop();
+        }
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    /* Overflowing the buffer settles the mod-tap-hold key as held instead of clearing the keyboard. */
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_B));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_C));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_D));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    regular_keys.back().release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release mod-tap-hold key. */
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_hold_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}